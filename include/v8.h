@@ -1549,6 +1549,27 @@ class V8_EXPORT ScriptCompiler {
   static V8_WARN_UNUSED_RESULT MaybeLocal<Module> CompileModule(
       Isolate* isolate, Source* source);
 
+  /**
+   * Returns a task which streams module data into V8, or NULL if the module
+   * cannot be streamed. Works like StartStreamingScript, except that the
+   * source is parsed as an ES module and the result must be compiled with
+   * the streaming variant of CompileModule below.
+   */
+  static ScriptStreamingTask* StartStreamingModule(Isolate* isolate,
+                                                   StreamedSource* source);
+
+  /**
+   * Compiles a streamed ES module.
+   *
+   * This can only be called after the streaming has finished
+   * (ScriptStreamingTask has been run). As with streamed scripts, the
+   * embedder needs to pass the full source here, and the origin must be
+   * marked as a module.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<Module> CompileModule(
+      Local<Context> context, StreamedSource* source,
+      Local<String> full_source_string, const ScriptOrigin& origin);
+
   /**
    * Compile a function for a given context. This is equivalent to running
    *
@@ -1854,6 +1875,41 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Parses JSON text that arrives as UTF-8 in chunks, e.g. from the network,
+   * without first collecting it into one string. The elements of a top-level
+   * array and the properties of a top-level object are parsed as soon as a
+   * chunk completes them, so only the text of an incomplete one is kept.
+   */
+  class V8_EXPORT StreamingParser {
+   public:
+    explicit StreamingParser(Isolate* isolate);
+    ~StreamingParser();
+
+    /**
+     * Parses the next |length| bytes of the text. A character may be split
+     * across chunks, and invalid sequences are replaced by U+FFFD. Fails if
+     * the text isn't valid JSON so far, in which case the parser starts over
+     * with the next chunk.
+     */
+    V8_WARN_UNUSED_RESULT Maybe<bool> Feed(Local<Context> context,
+                                           const uint8_t* data,
+                                           size_t length);
+
+    /**
+     * Returns the value of the text fed so far like JSON::Parse. The parser
+     * can be used for new text afterwards.
+     */
+    V8_WARN_UNUSED_RESULT MaybeLocal<Value> Finish(Local<Context> context);
+
+   private:
+    StreamingParser(const StreamingParser&) = delete;
+    void operator=(const StreamingParser&) = delete;
+
+    struct PrivateData;
+    PrivateData* private_;
+  };
 };
 
 /**
@@ -1971,6 +2027,17 @@ class V8_EXPORT ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  /**
+   * Indicate whether to write plain objects as references to shared object
+   * shapes, each of which lists its property names once, and packed double
+   * arrays as raw data. This makes arrays of similar objects smaller and
+   * faster to deserialize. Only use this when the data is read by a
+   * ValueDeserializer of the same or a later V8 version.
+   *
+   * The default is not to use these encodings.
+   */
+  void SetUseCompactEncoding(bool mode);
+
   /**
    * Write raw data in various common formats to the buffer.
    * Note that integer types are written in base-128 varint format, not with a
@@ -6196,6 +6263,9 @@ class V8_EXPORT ResourceConstraints {
     code_range_size_ = limit_in_mb;
   }
   size_t max_zone_pool_size() const { return max_zone_pool_size_; }
+  // Sets how many bytes of zone memory are kept for reuse, 0 to keep none.
+  // A pool of 2MB or more also keeps the largest zone segments, so that large
+  // scripts parsed one after another reuse the same memory.
   void set_max_zone_pool_size(size_t bytes) { max_zone_pool_size_ = bytes; }
 
  private:
@@ -2581,7 +2581,16 @@ ScriptCompiler::ScriptStreamingTask* ScriptCompiler::StartStreamingScript(
   // TODO(rmcilroy): remove CompileOptions from the API.
   CHECK(options == ScriptCompiler::kNoCompileOptions);
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
-  return i::Compiler::NewBackgroundCompileTask(source->impl(), isolate);
+  return i::Compiler::NewBackgroundCompileTask(source->impl(), isolate, false);
+}
+
+ScriptCompiler::ScriptStreamingTask* ScriptCompiler::StartStreamingModule(
+    Isolate* v8_isolate, StreamedSource* source) {
+  if (!i::FLAG_script_streaming) {
+    return nullptr;
+  }
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  return i::Compiler::NewBackgroundCompileTask(source->impl(), isolate, true);
 }
 
 
@@ -2618,6 +2627,36 @@ MaybeLocal<Script> ScriptCompiler::Compile(Local<Context> context,
   RETURN_ESCAPED(bound);
 }
 
+MaybeLocal<Module> ScriptCompiler::CompileModule(
+    Local<Context> context, StreamedSource* v8_source,
+    Local<String> full_source_string, const ScriptOrigin& origin) {
+  Utils::ApiCheck(origin.Options().IsModule(),
+                  "v8::ScriptCompiler::CompileModule",
+                  "Invalid ScriptOrigin: is_module must be true");
+  PREPARE_FOR_EXECUTION(context, ScriptCompiler, CompileModule, Module);
+  TRACE_EVENT_CALL_STATS_SCOPED(isolate, "v8", "V8.ScriptCompiler");
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.CompileStreamedModule");
+
+  i::Handle<i::String> str = Utils::OpenHandle(*(full_source_string));
+  i::Compiler::ScriptDetails script_details = GetScriptDetails(
+      isolate, origin.ResourceName(), origin.ResourceLineOffset(),
+      origin.ResourceColumnOffset(), origin.SourceMapUrl(),
+      origin.HostDefinedOptions());
+  i::ScriptStreamingData* streaming_data = v8_source->impl();
+
+  i::MaybeHandle<i::SharedFunctionInfo> maybe_function_info =
+      i::Compiler::GetSharedFunctionInfoForStreamedScript(
+          str, script_details, origin.Options(), streaming_data);
+
+  i::Handle<i::SharedFunctionInfo> result;
+  has_pending_exception = !maybe_function_info.ToHandle(&result);
+  if (has_pending_exception) isolate->ReportPendingMessages();
+
+  RETURN_ON_FAILED_EXECUTION(Module);
+  RETURN_ESCAPED(ToApiHandle<Module>(isolate->factory()->NewModule(result)));
+}
+
 uint32_t ScriptCompiler::CachedDataVersionTag() {
   return static_cast<uint32_t>(base::hash_combine(
       internal::Version::Hash(), internal::FlagList::Hash(),
@@ -3112,6 +3151,37 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+struct JSON::StreamingParser::PrivateData {
+  explicit PrivateData(i::Isolate* i) : isolate(i), parser(i) {}
+  i::Isolate* isolate;
+  i::JsonStreamingParser parser;
+};
+
+JSON::StreamingParser::StreamingParser(Isolate* isolate)
+    : private_(new PrivateData(reinterpret_cast<i::Isolate*>(isolate))) {}
+
+JSON::StreamingParser::~StreamingParser() { delete private_; }
+
+Maybe<bool> JSON::StreamingParser::Feed(Local<Context> context,
+                                        const uint8_t* data, size_t length) {
+  auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  DCHECK_EQ(isolate, private_->isolate);
+  ENTER_V8(isolate, context, JSON, StreamingParser_Feed, Nothing<bool>(),
+           i::HandleScope);
+  has_pending_exception = !private_->parser.Feed(data, length);
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  return Just(true);
+}
+
+MaybeLocal<Value> JSON::StreamingParser::Finish(Local<Context> context) {
+  PREPARE_FOR_EXECUTION(context, JSON, StreamingParser_Finish, Value);
+  DCHECK_EQ(isolate, private_->isolate);
+  Local<Value> result;
+  has_pending_exception = !ToLocal<Value>(private_->parser.Finish(), &result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(result);
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 Maybe<bool> ValueSerializer::Delegate::WriteHostObject(Isolate* v8_isolate,
@@ -3170,6 +3240,10 @@ void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
   private_->serializer.SetTreatArrayBufferViewsAsHostObjects(mode);
 }
 
+void ValueSerializer::SetUseCompactEncoding(bool mode) {
+  private_->serializer.SetUseCompactEncoding(mode);
+}
+
 Maybe<bool> ValueSerializer::WriteValue(Local<Context> context,
                                         Local<Value> value) {
   auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
@@ -9529,8 +9603,8 @@ uint32_t debug::WasmScript::GetFunctionHash(int function_index) {
       module_bytes->GetFlatContent().ToOneByteVector());
   i::Vector<const i::byte> function_bytes = wire_bytes.GetFunctionBytes(&func);
   // TODO(herhut): Maybe also take module, name and signature into account.
-  return i::StringHasher::HashSequentialString(function_bytes.start(),
-                                               function_bytes.length(), 0);
+  return i::StringHasher::HashSequentialStringOneAtATime(
+      function_bytes.start(), function_bytes.length(), 0);
 }
 
 debug::WasmDisassembly debug::WasmScript::DisassembleFunction(
@@ -544,6 +544,11 @@ void AstTraversalVisitor<Subclass>::VisitGetTemplateObject(
   PROCESS_EXPRESSION(expr);
 }
 
+template <class Subclass>
+void AstTraversalVisitor<Subclass>::VisitJsonLiteral(JsonLiteral* expr) {
+  PROCESS_EXPRESSION(expr);
+}
+
 template <class Subclass>
 void AstTraversalVisitor<Subclass>::VisitTemplateLiteral(
     TemplateLiteral* expr) {
@@ -91,6 +91,7 @@ namespace internal {
   V(GetIterator)                \
   V(GetTemplateObject)          \
   V(ImportCallExpression)       \
+  V(JsonLiteral)                \
   V(Literal)                    \
   V(NativeFunctionLiteral)      \
   V(Property)                   \
@@ -2666,6 +2667,22 @@ class GetTemplateObject final : public Expression {
   const ZoneList<const AstRawString*>* raw_strings_;
 };
 
+// An object or array literal of top-level code that consists of plain JSON
+// text. It isn't parsed into the AST; the JSON parser creates its value from
+// the source range [position(), end_position()) of the script instead.
+class JsonLiteral final : public Expression {
+ public:
+  int end_position() const { return end_position_; }
+
+ private:
+  friend class AstNodeFactory;
+
+  JsonLiteral(int pos, int end_position)
+      : Expression(pos, kJsonLiteral), end_position_(end_position) {}
+
+  int end_position_;
+};
+
 class TemplateLiteral final : public Expression {
  public:
   using StringList = ZoneList<const AstRawString*>;
@@ -3268,6 +3285,10 @@ class AstNodeFactory final BASE_EMBEDDED {
     return new (zone_) GetTemplateObject(cooked_strings, raw_strings, pos);
   }
 
+  JsonLiteral* NewJsonLiteral(int pos, int end_position) {
+    return new (zone_) JsonLiteral(pos, end_position);
+  }
+
   TemplateLiteral* NewTemplateLiteral(
       const ZoneList<const AstRawString*>* string_parts,
       const ZoneList<Expression*>* substitutions, int pos) {
@@ -471,6 +471,8 @@ void CallPrinter::VisitGetIterator(GetIterator* node) {
 
 void CallPrinter::VisitGetTemplateObject(GetTemplateObject* node) {}
 
+void CallPrinter::VisitJsonLiteral(JsonLiteral* node) {}
+
 void CallPrinter::VisitTemplateLiteral(TemplateLiteral* node) {
   for (Expression* substitution : *node->substitutions()) {
     Find(substitution, true);
@@ -1349,6 +1351,10 @@ void AstPrinter::VisitGetTemplateObject(GetTemplateObject* node) {
   IndentedScope indent(this, "GET-TEMPLATE-OBJECT", node->position());
 }
 
+void AstPrinter::VisitJsonLiteral(JsonLiteral* node) {
+  IndentedScope indent(this, "JSON LITERAL", node->position());
+}
+
 void AstPrinter::VisitTemplateLiteral(TemplateLiteral* node) {
   IndentedScope indent(this, "TEMPLATE-LITERAL", node->position());
   const AstRawString* string = node->string_parts()->first();
@@ -250,6 +250,27 @@ V8_BASE_EXPORT int32_t SignedMulHigh32(int32_t lhs, int32_t rhs);
 V8_BASE_EXPORT int32_t SignedMulHighAndAdd32(int32_t lhs, int32_t rhs,
                                              int32_t acc);
 
+// UnsignedMulFull64(lhs, rhs, high) multiplies two unsigned 64-bit values
+// |lhs| and |rhs|, stores the most significant 64 bits of the 128-bit product
+// into the variable pointed to by |high| and returns the least significant
+// 64 bits.
+inline uint64_t UnsignedMulFull64(uint64_t lhs, uint64_t rhs, uint64_t* high) {
+#if defined(__SIZEOF_INT128__)
+  unsigned __int128 product = static_cast<unsigned __int128>(lhs) * rhs;
+  *high = static_cast<uint64_t>(product >> 64);
+  return static_cast<uint64_t>(product);
+#else
+  const uint64_t kLow32 = 0xFFFFFFFFu;
+  uint64_t ll = (lhs & kLow32) * (rhs & kLow32);
+  uint64_t lh = (lhs & kLow32) * (rhs >> 32);
+  uint64_t hl = (lhs >> 32) * (rhs & kLow32);
+  uint64_t hh = (lhs >> 32) * (rhs >> 32);
+  uint64_t middle = (ll >> 32) + (lh & kLow32) + (hl & kLow32);
+  *high = hh + (lh >> 32) + (hl >> 32) + (middle >> 32);
+  return (middle << 32) | (ll & kLow32);
+#endif
+}
+
 // SignedDiv32(lhs, rhs) divides |lhs| by |rhs| and returns the quotient
 // truncated to int32. If |rhs| is zero, then zero is returned. If |lhs|
 // is minint and |rhs| is -1, it returns minint.
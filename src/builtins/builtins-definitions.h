@@ -90,6 +90,7 @@ namespace internal {
   ASM(StackCheck)                                                              \
                                                                                \
   /* String helpers */                                                         \
+  TFS(NewConsString, kLength, kLeft, kRight)                                   \
   TFC(StringCharAt, StringAt, 1)                                               \
   TFC(StringCodePointAtUTF16, StringAt, 1)                                     \
   TFC(StringCodePointAtUTF32, StringAt, 1)                                     \
@@ -943,11 +944,15 @@ namespace internal {
   TFJ(RegExpPrototypeSplit, SharedFunctionInfo::kDontAdaptArgumentsSentinel)   \
   /* RegExp helpers */                                                         \
   TFS(RegExpExecAtom, kRegExp, kString, kLastIndex, kMatchInfo)                \
+  TFS(RegExpExecString, kReceiver, kString)                                    \
+  TFS(RegExpExecStringFirstMatch, kReceiver, kString)                          \
+  TFS(RegExpExecStringWithoutResult, kReceiver, kString)                       \
   TFS(RegExpMatchFast, kReceiver, kPattern)                                    \
   TFS(RegExpPrototypeExecSlow, kReceiver, kString)                             \
   TFS(RegExpReplace, kRegExp, kString, kReplaceValue)                          \
   TFS(RegExpSearchFast, kReceiver, kPattern)                                   \
   TFS(RegExpSplit, kRegExp, kString, kLimit)                                   \
+  TFS(RegExpTestString, kReceiver, kString)                                    \
                                                                                \
   /* RegExp String Iterator */                                                 \
   /* https://tc39.github.io/proposal-string-matchall/ */                       \
@@ -229,7 +229,7 @@ Node* RegExpBuiltinsAssembler::ConstructNewResultFromMatchInfo(
   BIND(&named_captures);
   {
     // We reach this point only if captures exist, implying that this is an
-    // IRREGEXP JSRegExp.
+    // IRREGEXP or LINEAR JSRegExp.
 
     CSA_ASSERT(this, IsJSRegExp(regexp));
     CSA_ASSERT(this, SmiGreaterThan(num_results, SmiConstant(1)));
@@ -238,8 +238,13 @@ Node* RegExpBuiltinsAssembler::ConstructNewResultFromMatchInfo(
     // not have any named captures to minimize performance impact.
 
     Node* const data = LoadObjectField(regexp, JSRegExp::kDataOffset);
-    CSA_ASSERT(this, SmiEqual(LoadFixedArrayElement(data, JSRegExp::kTagIndex),
-                              SmiConstant(JSRegExp::IRREGEXP)));
+    CSA_ASSERT(this,
+               Word32Or(SmiEqual(LoadFixedArrayElement(data,
+                                                       JSRegExp::kTagIndex),
+                                 SmiConstant(JSRegExp::IRREGEXP)),
+                        SmiEqual(LoadFixedArrayElement(data,
+                                                       JSRegExp::kTagIndex),
+                                 SmiConstant(JSRegExp::LINEAR))));
 
     // The names fixed array associates names at even indices with a capture
     // index at odd indices.
@@ -321,6 +326,67 @@ void RegExpBuiltinsAssembler::GetStringPointers(
   var_string_end->Bind(IntPtrAdd(string_data, to_offset));
 }
 
+Node* RegExpBuiltinsAssembler::SkipToRequiredLiteral(
+    Node* const data, Node* const string_data, Node* const offset,
+    Node* const last_index, Node* const string_length,
+    String::Encoding encoding, Label* if_failure) {
+  VARIABLE(var_result, MachineType::PointerRepresentation(), last_index);
+  Label out(this);
+
+  // Two-byte literals are left to the runtime.
+  Node* const literal =
+      LoadFixedArrayElement(data, JSRegExp::kIrregexpRequiredLiteralIndex);
+  GotoIf(TaggedIsSmi(literal), &out);
+  GotoIfNot(IsOneByteStringInstanceType(LoadInstanceType(literal)), &out);
+  CSA_ASSERT(this, IsSequentialStringInstanceType(LoadInstanceType(literal)));
+
+  Node* const min_offset = SmiUntag(CAST(LoadFixedArrayElement(
+      data, JSRegExp::kIrregexpRequiredLiteralMinOffsetIndex)));
+  Node* const search_start = IntPtrAdd(last_index, min_offset);
+  Node* const literal_length = LoadStringLengthAsWord(literal);
+  GotoIf(IntPtrGreaterThan(IntPtrAdd(search_start, literal_length),
+                           string_length),
+         if_failure);
+
+  const ElementsKind kind = (encoding == String::ONE_BYTE_ENCODING)
+                                ? UINT8_ELEMENTS
+                                : UINT16_ELEMENTS;
+  Node* const subject_ptr = IntPtrAdd(
+      string_data, ElementOffsetFromIndex(offset, kind, INTPTR_PARAMETERS));
+  Node* const literal_ptr =
+      IntPtrAdd(BitcastTaggedToWord(literal),
+                IntPtrConstant(SeqOneByteString::kHeaderSize - kHeapObjectTag));
+  Node* const function_addr = ExternalConstant(
+      (encoding == String::ONE_BYTE_ENCODING)
+          ? ExternalReference::search_string_raw<const uint8_t, const uint8_t>(
+                isolate())
+          : ExternalReference::search_string_raw<const uc16, const uint8_t>(
+                isolate()));
+  Node* const isolate_ptr =
+      ExternalConstant(ExternalReference::isolate_address(isolate()));
+
+  MachineType type_ptr = MachineType::Pointer();
+  MachineType type_intptr = MachineType::IntPtr();
+  Node* const found = CallCFunction6(
+      type_intptr, type_ptr, type_ptr, type_intptr, type_ptr, type_intptr,
+      type_intptr, function_addr, isolate_ptr, subject_ptr, string_length,
+      literal_ptr, literal_length, search_start);
+  GotoIf(IntPtrLessThan(found, IntPtrConstant(0)), if_failure);
+
+  // Without a bound on the offset of the literal, the match may start
+  // anywhere before it.
+  Node* const max_offset = SmiUntag(CAST(LoadFixedArrayElement(
+      data, JSRegExp::kIrregexpRequiredLiteralMaxOffsetIndex)));
+  GotoIf(IntPtrLessThan(max_offset, IntPtrConstant(0)), &out);
+  Node* const match_start = IntPtrSub(found, max_offset);
+  GotoIfNot(IntPtrGreaterThan(match_start, last_index), &out);
+  var_result.Bind(match_start);
+  Goto(&out);
+
+  BIND(&out);
+  return var_result.value();
+}
+
 Node* RegExpBuiltinsAssembler::RegExpExecInternal(Node* const context,
                                                   Node* const regexp,
                                                   Node* const string,
@@ -389,8 +455,9 @@ Node* RegExpBuiltinsAssembler::RegExpExecInternal(Node* const context,
 
       int32_t values[] = {
           JSRegExp::IRREGEXP, JSRegExp::ATOM, JSRegExp::NOT_COMPILED,
+          JSRegExp::LINEAR,
       };
-      Label* labels[] = {&next, &atom, &runtime};
+      Label* labels[] = {&next, &atom, &runtime, &runtime};
 
       STATIC_ASSERT(arraysize(values) == arraysize(labels));
       Switch(tag, &unreachable, values, labels, arraysize(values));
@@ -432,6 +499,7 @@ Node* RegExpBuiltinsAssembler::RegExpExecInternal(Node* const context,
   VARIABLE(var_string_start, MachineType::PointerRepresentation());
   VARIABLE(var_string_end, MachineType::PointerRepresentation());
   VARIABLE(var_code, MachineRepresentation::kTagged);
+  VARIABLE(var_start_index, MachineType::PointerRepresentation());
 
   {
     Node* const direct_string_data = to_direct.PointerToData(&runtime);
@@ -442,9 +510,13 @@ Node* RegExpBuiltinsAssembler::RegExpExecInternal(Node* const context,
 
     BIND(&if_isonebyte);
     {
-      GetStringPointers(direct_string_data, to_direct.offset(), int_last_index,
-                        int_string_length, String::ONE_BYTE_ENCODING,
-                        &var_string_start, &var_string_end);
+      var_start_index.Bind(SkipToRequiredLiteral(
+          data, direct_string_data, to_direct.offset(), int_last_index,
+          int_string_length, String::ONE_BYTE_ENCODING, &if_failure));
+      GetStringPointers(direct_string_data, to_direct.offset(),
+                        var_start_index.value(), int_string_length,
+                        String::ONE_BYTE_ENCODING, &var_string_start,
+                        &var_string_end);
       var_code.Bind(
           LoadFixedArrayElement(data, JSRegExp::kIrregexpLatin1CodeIndex));
       Goto(&next);
@@ -452,9 +524,13 @@ Node* RegExpBuiltinsAssembler::RegExpExecInternal(Node* const context,
 
     BIND(&if_istwobyte);
     {
-      GetStringPointers(direct_string_data, to_direct.offset(), int_last_index,
-                        int_string_length, String::TWO_BYTE_ENCODING,
-                        &var_string_start, &var_string_end);
+      var_start_index.Bind(SkipToRequiredLiteral(
+          data, direct_string_data, to_direct.offset(), int_last_index,
+          int_string_length, String::TWO_BYTE_ENCODING, &if_failure));
+      GetStringPointers(direct_string_data, to_direct.offset(),
+                        var_start_index.value(), int_string_length,
+                        String::TWO_BYTE_ENCODING, &var_string_start,
+                        &var_string_end);
       var_code.Bind(
           LoadFixedArrayElement(data, JSRegExp::kIrregexpUC16CodeIndex));
       Goto(&next);
@@ -464,8 +540,9 @@ Node* RegExpBuiltinsAssembler::RegExpExecInternal(Node* const context,
   }
 
   // Check that the irregexp code has been generated for the actual string
-  // encoding. If it has, the field contains a code object; and otherwise it
-  // contains the uninitialized sentinel as a smi.
+  // encoding. If it has, the field contains a code object, or bytecode if the
+  // regexp has not tiered up yet; and otherwise it contains the uninitialized
+  // sentinel as a smi. Bytecode is run by the interpreter in the runtime.
 
   Node* const code = var_code.value();
   CSA_ASSERT_BRANCH(this, [=](Label* ok, Label* not_ok) {
@@ -474,7 +551,7 @@ Node* RegExpBuiltinsAssembler::RegExpExecInternal(Node* const context,
            not_ok);
   });
   GotoIf(TaggedIsSmi(code), &runtime);
-  CSA_ASSERT(this, HasInstanceType(code, CODE_TYPE));
+  GotoIfNot(HasInstanceType(code, CODE_TYPE), &runtime);
 
   Label if_success(this), if_exception(this, Label::kDeferred);
   {
@@ -495,7 +572,7 @@ Node* RegExpBuiltinsAssembler::RegExpExecInternal(Node* const context,
 
     // Argument 1: Previous index.
     MachineType arg1_type = type_int32;
-    Node* const arg1 = TruncateIntPtrToInt32(int_last_index);
+    Node* const arg1 = TruncateIntPtrToInt32(var_start_index.value());
 
     // Argument 2: Start of string data.
     MachineType arg2_type = type_ptr;
@@ -1051,25 +1128,111 @@ TF_BUILTIN(RegExpPrototypeExec, RegExpBuiltinsAssembler) {
   // Convert {maybe_string} to a String.
   TNode<String> const string = ToString_Inline(context, maybe_string);
 
+  RegExpPrototypeExecString(context, receiver, string);
+}
+
+void RegExpBuiltinsAssembler::RegExpPrototypeExecString(
+    Node* const context, Node* const regexp, TNode<String> const string) {
+  CSA_ASSERT(this, IsJSRegExp(regexp));
+
   Label if_isfastpath(this), if_isslowpath(this);
-  Branch(IsFastRegExpNoPrototype(context, receiver), &if_isfastpath,
+  Branch(IsFastRegExpNoPrototype(context, regexp), &if_isfastpath,
          &if_isslowpath);
 
   BIND(&if_isfastpath);
   {
-    Node* const result =
-        RegExpPrototypeExecBody(context, receiver, string, true);
+    Node* const result = RegExpPrototypeExecBody(context, regexp, string, true);
     Return(result);
   }
 
   BIND(&if_isslowpath);
   {
     Node* const result = CallBuiltin(Builtins::kRegExpPrototypeExecSlow,
-                                     context, receiver, string);
+                                     context, regexp, string);
     Return(result);
   }
 }
 
+// Helper that skips a few initial checks. and assumes...
+// 1) receiver is a JSRegExp
+// 2) string is a string
+TF_BUILTIN(RegExpExecString, RegExpBuiltinsAssembler) {
+  Node* const receiver = Parameter(Descriptor::kReceiver);
+  TNode<String> const string = CAST(Parameter(Descriptor::kString));
+  Node* const context = Parameter(Descriptor::kContext);
+
+  RegExpPrototypeExecString(context, receiver, string);
+}
+
+// Like RegExpExecString, for calls whose result is unused: performs the match
+// and its side effects on lastIndex and the last match info, but does not
+// allocate the result array. Returns whether the match succeeded.
+TF_BUILTIN(RegExpExecStringWithoutResult, RegExpBuiltinsAssembler) {
+  Node* const receiver = Parameter(Descriptor::kReceiver);
+  TNode<String> const string = CAST(Parameter(Descriptor::kString));
+  Node* const context = Parameter(Descriptor::kContext);
+
+  CSA_ASSERT(this, IsJSRegExp(receiver));
+
+  Label if_isfastpath(this), if_isslowpath(this), if_didnotmatch(this);
+  Branch(IsFastRegExpNoPrototype(context, receiver), &if_isfastpath,
+         &if_isslowpath);
+
+  BIND(&if_isfastpath);
+  RegExpPrototypeExecBodyWithoutResult(context, receiver, string,
+                                       &if_didnotmatch, true);
+  Return(TrueConstant());
+
+  BIND(&if_isslowpath);
+  RegExpPrototypeExecBodyWithoutResult(context, receiver, string,
+                                       &if_didnotmatch, false);
+  Return(TrueConstant());
+
+  BIND(&if_didnotmatch);
+  Return(FalseConstant());
+}
+
+// Like RegExpExecString, for calls whose result is only used to load its
+// element 0: returns the matched substring without allocating the result
+// array, and throws the TypeError of that load if there is no match.
+TF_BUILTIN(RegExpExecStringFirstMatch, RegExpBuiltinsAssembler) {
+  Node* const receiver = Parameter(Descriptor::kReceiver);
+  TNode<String> const string = CAST(Parameter(Descriptor::kString));
+  Node* const context = Parameter(Descriptor::kContext);
+
+  CSA_ASSERT(this, IsJSRegExp(receiver));
+
+  VARIABLE(var_match_indices, MachineRepresentation::kTagged);
+  Label if_isfastpath(this), if_isslowpath(this), if_didnotmatch(this),
+      if_didmatch(this, &var_match_indices);
+  Branch(IsFastRegExpNoPrototype(context, receiver), &if_isfastpath,
+         &if_isslowpath);
+
+  BIND(&if_isfastpath);
+  var_match_indices.Bind(RegExpPrototypeExecBodyWithoutResult(
+      context, receiver, string, &if_didnotmatch, true));
+  Goto(&if_didmatch);
+
+  BIND(&if_isslowpath);
+  var_match_indices.Bind(RegExpPrototypeExecBodyWithoutResult(
+      context, receiver, string, &if_didnotmatch, false));
+  Goto(&if_didmatch);
+
+  BIND(&if_didmatch);
+  {
+    Node* const match_indices = var_match_indices.value();
+    Node* const match_from = LoadFixedArrayElement(
+        match_indices, RegExpMatchInfo::kFirstCaptureIndex);
+    Node* const match_to = LoadFixedArrayElement(
+        match_indices, RegExpMatchInfo::kFirstCaptureIndex + 1);
+    Return(SubString(string, SmiUntag(match_from), SmiUntag(match_to)));
+  }
+
+  BIND(&if_didnotmatch);
+  ThrowTypeError(context, MessageTemplate::kNonObjectPropertyLoad,
+                 SmiConstant(0), NullConstant());
+}
+
 Node* RegExpBuiltinsAssembler::FlagsGetter(Node* const context,
                                            Node* const regexp,
                                            bool is_fastpath) {
@@ -1712,13 +1875,20 @@ TF_BUILTIN(RegExpPrototypeTest, RegExpBuiltinsAssembler) {
   // Convert {maybe_string} to a String.
   TNode<String> const string = ToString_Inline(context, maybe_string);
 
+  RegExpPrototypeTestString(context, receiver, string);
+}
+
+void RegExpBuiltinsAssembler::RegExpPrototypeTestString(
+    Node* const context, Node* const regexp, TNode<String> const string) {
+  CSA_ASSERT(this, IsJSReceiver(regexp));
+
   Label fast_path(this), slow_path(this);
-  BranchIfFastRegExp(context, receiver, &fast_path, &slow_path);
+  BranchIfFastRegExp(context, regexp, &fast_path, &slow_path);
 
   BIND(&fast_path);
   {
     Label if_didnotmatch(this);
-    RegExpPrototypeExecBodyWithoutResult(context, receiver, string,
+    RegExpPrototypeExecBodyWithoutResult(context, regexp, string,
                                          &if_didnotmatch, true);
     Return(TrueConstant());
 
@@ -1729,7 +1899,7 @@ TF_BUILTIN(RegExpPrototypeTest, RegExpBuiltinsAssembler) {
   BIND(&slow_path);
   {
     // Call exec.
-    Node* const match_indices = RegExpExec(context, receiver, string);
+    Node* const match_indices = RegExpExec(context, regexp, string);
 
     // Return true iff exec matched successfully.
     Node* const result = SelectBooleanConstant(IsNotNull(match_indices));
@@ -1737,6 +1907,17 @@ TF_BUILTIN(RegExpPrototypeTest, RegExpBuiltinsAssembler) {
   }
 }
 
+// Helper that skips a few initial checks. and assumes...
+// 1) receiver is a JSReceiver
+// 2) string is a string
+TF_BUILTIN(RegExpTestString, RegExpBuiltinsAssembler) {
+  Node* const receiver = Parameter(Descriptor::kReceiver);
+  TNode<String> const string = CAST(Parameter(Descriptor::kString));
+  Node* const context = Parameter(Descriptor::kContext);
+
+  RegExpPrototypeTestString(context, receiver, string);
+}
+
 Node* RegExpBuiltinsAssembler::AdvanceStringIndex(Node* const string,
                                                   Node* const index,
                                                   Node* const is_unicode,
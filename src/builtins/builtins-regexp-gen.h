@@ -56,6 +56,15 @@ class RegExpBuiltinsAssembler : public CodeStubAssembler {
                          String::Encoding encoding, Variable* var_string_start,
                          Variable* var_string_end);
 
+  // Returns the first position at or after {last_index} at which a match can
+  // start, judging by the one-byte literal that every match of the irregexp
+  // with the given {data} contains. Jumps to {if_failure} if the literal does
+  // not occur.
+  Node* SkipToRequiredLiteral(Node* const data, Node* const string_data,
+                              Node* const offset, Node* const last_index,
+                              Node* const string_length,
+                              String::Encoding encoding, Label* if_failure);
+
   // Low level logic around the actual call into pattern matching code.
   Node* RegExpExecInternal(Node* const context, Node* const regexp,
                            Node* const string, Node* const last_index,
@@ -73,6 +82,13 @@ class RegExpBuiltinsAssembler : public CodeStubAssembler {
   Node* RegExpPrototypeExecBody(Node* const context, Node* const regexp,
                                 TNode<String> string, const bool is_fastpath);
 
+  // The parts of RegExp.prototype.exec and RegExp.prototype.test that follow
+  // the receiver check and the conversion of the argument to a String.
+  void RegExpPrototypeExecString(Node* const context, Node* const regexp,
+                                 TNode<String> const string);
+  void RegExpPrototypeTestString(Node* const context, Node* const regexp,
+                                 TNode<String> const string);
+
   Node* ThrowIfNotJSReceiver(Node* context, Node* maybe_receiver,
                              MessageTemplate::Template msg_template,
                              char const* method_name);
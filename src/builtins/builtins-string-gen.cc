@@ -478,6 +478,15 @@ void StringBuiltinsAssembler::GenerateStringRelationalComparison(Node* context,
   }
 }
 
+// Called from optimized code to allocate cons strings that need rebalancing.
+TF_BUILTIN(NewConsString, CodeStubAssembler) {
+  Node* context = Parameter(Descriptor::kContext);
+  TNode<Smi> length = CAST(Parameter(Descriptor::kLength));
+  TNode<String> left = CAST(Parameter(Descriptor::kLeft));
+  TNode<String> right = CAST(Parameter(Descriptor::kRight));
+  Return(NewConsString(context, length, left, right));
+}
+
 TF_BUILTIN(StringEqual, StringBuiltinsAssembler) {
   Node* context = Parameter(Descriptor::kContext);
   Node* left = Parameter(Descriptor::kLeft);
@@ -2705,21 +2705,18 @@ TNode<String> CodeStubAssembler::AllocateTwoByteConsString(
                             second, flags);
 }
 
-TNode<String> CodeStubAssembler::NewConsString(Node* context, TNode<Smi> length,
-                                               TNode<String> left,
-                                               TNode<String> right,
-                                               AllocationFlags flags) {
-  CSA_ASSERT(this, IsContext(context));
-  // Added string can be a cons string.
-  Comment("Allocating ConsString");
-  Node* left_instance_type = LoadInstanceType(left);
-  Node* right_instance_type = LoadInstanceType(right);
+TNode<String> CodeStubAssembler::AllocateConsString(TNode<Smi> length,
+                                                    TNode<String> first,
+                                                    TNode<String> second,
+                                                    AllocationFlags flags) {
+  Node* first_instance_type = LoadInstanceType(first);
+  Node* second_instance_type = LoadInstanceType(second);
 
   // Compute intersection and difference of instance types.
   Node* anded_instance_types =
-      Word32And(left_instance_type, right_instance_type);
+      Word32And(first_instance_type, second_instance_type);
   Node* xored_instance_types =
-      Word32Xor(left_instance_type, right_instance_type);
+      Word32Xor(first_instance_type, second_instance_type);
 
   // We create a one-byte cons string if
   // 1. both strings are one-byte, or
@@ -2747,12 +2744,12 @@ TNode<String> CodeStubAssembler::NewConsString(Node* context, TNode<Smi> length,
 
   BIND(&one_byte_map);
   Comment("One-byte ConsString");
-  result = AllocateOneByteConsString(length, left, right, flags);
+  result = AllocateOneByteConsString(length, first, second, flags);
   Goto(&done);
 
   BIND(&two_byte_map);
   Comment("Two-byte ConsString");
-  result = AllocateTwoByteConsString(length, left, right, flags);
+  result = AllocateTwoByteConsString(length, first, second, flags);
   Goto(&done);
 
   BIND(&done);
@@ -2760,6 +2757,115 @@ TNode<String> CodeStubAssembler::NewConsString(Node* context, TNode<Smi> length,
   return result.value();
 }
 
+TNode<String> CodeStubAssembler::NewConsString(Node* context, TNode<Smi> length,
+                                               TNode<String> left,
+                                               TNode<String> right,
+                                               AllocationFlags flags) {
+  CSA_ASSERT(this, IsZeroOrContext(context));
+  // Added string can be a cons string.
+  Comment("Allocating ConsString");
+  TVARIABLE(String, var_left, left);
+  TVARIABLE(String, var_right, right);
+  Variable* input_vars[2] = {&var_left, &var_right};
+  Label balance(this, 2, input_vars), allocate(this);
+  Goto(&balance);
+
+  // While {left} is an unflattened cons string more than twice as long as
+  // {right} whose second part is at most twice as long as {right}, join that
+  // part with {right} first. This mirrors Factory::NewConsString; the joined
+  // pair needs no further balancing, so this doesn't recurse.
+  BIND(&balance);
+  {
+    TNode<String> current_left = var_left.value();
+    TNode<String> current_right = var_right.value();
+    GotoIfNot(IsConsStringInstanceType(LoadInstanceType(current_left)),
+              &allocate);
+    TNode<Smi> right_length = LoadStringLengthAsSmi(current_right);
+    TNode<Smi> twice_right_length = SmiAdd(right_length, right_length);
+    GotoIfNot(
+        SmiGreaterThan(LoadStringLengthAsSmi(current_left), twice_right_length),
+        &allocate);
+    TNode<String> first =
+        CAST(LoadObjectField(current_left, ConsString::kFirstOffset));
+    TNode<String> second =
+        CAST(LoadObjectField(current_left, ConsString::kSecondOffset));
+    TNode<Smi> second_length = LoadStringLengthAsSmi(second);
+    // The second part of a flattened cons string is empty.
+    GotoIf(SmiEqual(second_length, SmiConstant(0)), &allocate);
+    GotoIf(SmiGreaterThan(second_length, twice_right_length), &allocate);
+
+    Label join_cons(this), join_flat(this);
+    TNode<Smi> pair_length = SmiAdd(second_length, right_length);
+    Branch(SmiLessThan(pair_length, SmiConstant(ConsString::kMinLength)),
+           &join_flat, &join_cons);
+
+    BIND(&join_cons);
+    var_right = AllocateConsString(pair_length, second, current_right, flags);
+    var_left = first;
+    Goto(&balance);
+
+    BIND(&join_flat);
+    {
+      // Short pairs must be flat. Give up on balancing unless both parts are
+      // sequential with the same encoding.
+      Node* second_instance_type = LoadInstanceType(second);
+      Node* right_instance_type = LoadInstanceType(current_right);
+      GotoIf(IsSetWord32(Word32Or(second_instance_type, right_instance_type),
+                         kStringRepresentationMask),
+             &allocate);
+      GotoIf(IsSetWord32(Word32Xor(second_instance_type, right_instance_type),
+                         kStringEncodingMask),
+             &allocate);
+      var_right = ConcatenateSequentialStrings(
+          context, pair_length, second, current_right, right_instance_type);
+      var_left = first;
+      Goto(&balance);
+    }
+  }
+
+  BIND(&allocate);
+  return AllocateConsString(length, var_left.value(), var_right.value(), flags);
+}
+
+TNode<String> CodeStubAssembler::ConcatenateSequentialStrings(
+    Node* context, TNode<Smi> length, TNode<String> first, TNode<String> second,
+    Node* instance_type) {
+  CSA_ASSERT(this, IsSequentialStringInstanceType(instance_type));
+  TVARIABLE(String, result);
+  Label two_byte(this), done(this, &result);
+  TNode<IntPtrT> first_length = LoadStringLengthAsWord(first);
+  TNode<IntPtrT> second_length = LoadStringLengthAsWord(second);
+  GotoIf(Word32Equal(Word32And(instance_type,
+                               Int32Constant(kStringEncodingMask)),
+                     Int32Constant(kTwoByteStringTag)),
+         &two_byte);
+  // One-byte sequential string case
+  result = AllocateSeqOneByteString(context, length);
+  CopyStringCharacters(first, result.value(), IntPtrConstant(0),
+                       IntPtrConstant(0), first_length,
+                       String::ONE_BYTE_ENCODING, String::ONE_BYTE_ENCODING);
+  CopyStringCharacters(second, result.value(), IntPtrConstant(0), first_length,
+                       second_length, String::ONE_BYTE_ENCODING,
+                       String::ONE_BYTE_ENCODING);
+  Goto(&done);
+
+  BIND(&two_byte);
+  {
+    // Two-byte sequential string case
+    result = AllocateSeqTwoByteString(context, length);
+    CopyStringCharacters(first, result.value(), IntPtrConstant(0),
+                         IntPtrConstant(0), first_length,
+                         String::TWO_BYTE_ENCODING, String::TWO_BYTE_ENCODING);
+    CopyStringCharacters(second, result.value(), IntPtrConstant(0),
+                         first_length, second_length, String::TWO_BYTE_ENCODING,
+                         String::TWO_BYTE_ENCODING);
+    Goto(&done);
+  }
+
+  BIND(&done);
+  return result.value();
+}
+
 Node* CodeStubAssembler::AllocateNameDictionary(int at_least_space_for) {
   return AllocateNameDictionary(IntPtrConstant(at_least_space_for));
 }
@@ -5480,39 +5586,11 @@ TNode<String> CodeStubAssembler::StringAdd(Node* context, TNode<String> left,
     GotoIf(IsSetWord32(xored_instance_types, kStringEncodingMask), &runtime);
     GotoIf(IsSetWord32(ored_instance_types, kStringRepresentationMask), &slow);
 
-    TNode<IntPtrT> word_left_length = SmiUntag(left_length);
-    TNode<IntPtrT> word_right_length = SmiUntag(right_length);
-
-    Label two_byte(this);
-    GotoIf(Word32Equal(Word32And(ored_instance_types,
-                                 Int32Constant(kStringEncodingMask)),
-                       Int32Constant(kTwoByteStringTag)),
-           &two_byte);
-    // One-byte sequential string case
-    result = AllocateSeqOneByteString(context, new_length);
-    CopyStringCharacters(var_left.value(), result.value(), IntPtrConstant(0),
-                         IntPtrConstant(0), word_left_length,
-                         String::ONE_BYTE_ENCODING, String::ONE_BYTE_ENCODING);
-    CopyStringCharacters(var_right.value(), result.value(), IntPtrConstant(0),
-                         word_left_length, word_right_length,
-                         String::ONE_BYTE_ENCODING, String::ONE_BYTE_ENCODING);
+    result = ConcatenateSequentialStrings(context, new_length, var_left.value(),
+                                          var_right.value(),
+                                          ored_instance_types);
     Goto(&done_native);
 
-    BIND(&two_byte);
-    {
-      // Two-byte sequential string case
-      result = AllocateSeqTwoByteString(context, new_length);
-      CopyStringCharacters(var_left.value(), result.value(), IntPtrConstant(0),
-                           IntPtrConstant(0), word_left_length,
-                           String::TWO_BYTE_ENCODING,
-                           String::TWO_BYTE_ENCODING);
-      CopyStringCharacters(var_right.value(), result.value(), IntPtrConstant(0),
-                           word_left_length, word_right_length,
-                           String::TWO_BYTE_ENCODING,
-                           String::TWO_BYTE_ENCODING);
-      Goto(&done_native);
-    }
-
     BIND(&slow);
     {
       // Try to unwrap indirect strings, restart the above attempt on success.
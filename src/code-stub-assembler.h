@@ -873,7 +873,9 @@ class V8_EXPORT_PRIVATE CodeStubAssembler : public compiler::CodeAssembler {
                                           AllocationFlags flags = kNone);
 
   // Allocate an appropriate one- or two-byte ConsString with the first and
-  // second parts specified by |left| and |right|.
+  // second parts specified by |left| and |right|. If |left| is itself a
+  // ConsString, its trailing parts may first be joined with |right| to keep
+  // the tree balanced, see Factory::NewConsString.
   TNode<String> NewConsString(Node* context, TNode<Smi> length,
                               TNode<String> left, TNode<String> right,
                               AllocationFlags flags = kNone);
@@ -2253,6 +2255,18 @@ class V8_EXPORT_PRIVATE CodeStubAssembler : public compiler::CodeAssembler {
   TNode<String> AllocateConsString(Heap::RootListIndex map_root_index,
                                    TNode<Smi> length, TNode<String> first,
                                    TNode<String> second, AllocationFlags flags);
+  // Allocate a one- or two-byte ConsString as appropriate for the encodings
+  // of |first| and |second|.
+  TNode<String> AllocateConsString(TNode<Smi> length, TNode<String> first,
+                                   TNode<String> second, AllocationFlags flags);
+
+  // Allocate a sequential string of the given length holding the contents of
+  // the sequential strings |first| and |second|, which must both have the
+  // encoding of |instance_type|.
+  TNode<String> ConcatenateSequentialStrings(Node* context, TNode<Smi> length,
+                                             TNode<String> first,
+                                             TNode<String> second,
+                                             Node* instance_type);
 
   Node* SelectImpl(TNode<BoolT> condition, const NodeGenerator& true_body,
                    const NodeGenerator& false_body, MachineRepresentation rep);
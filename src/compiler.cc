@@ -808,6 +808,28 @@ bool FailWithPendingException(Isolate* isolate, ParseInfo* parse_info,
   return false;
 }
 
+// Hands the large top-level functions recorded by the parser to the compiler
+// dispatcher, which parses and compiles them on background threads. A later
+// lazy compile of such a function finishes the dispatcher job instead.
+void EnqueueParallelCompileCandidates(ParseInfo* parse_info, Isolate* isolate) {
+  if (parse_info->is_eval() || parse_info->script().is_null()) return;
+  Handle<Script> script = parse_info->script();
+  CompilerDispatcher* dispatcher = isolate->compiler_dispatcher();
+  for (int function_literal_id : parse_info->parallel_compile_candidates()) {
+    MaybeObject* maybe_shared =
+        script->shared_function_infos()->Get(function_literal_id);
+    HeapObject* heap_object;
+    if (!maybe_shared->ToStrongOrWeakHeapObject(&heap_object) ||
+        !heap_object->IsSharedFunctionInfo()) {
+      continue;
+    }
+    Handle<SharedFunctionInfo> shared(SharedFunctionInfo::cast(heap_object),
+                                      isolate);
+    if (shared->is_compiled()) continue;
+    if (!dispatcher->EnqueueAndStep(shared)) break;
+  }
+}
+
 MaybeHandle<SharedFunctionInfo> FinalizeTopLevel(
     ParseInfo* parse_info, Isolate* isolate,
     UnoptimizedCompilationJob* outer_function_job,
@@ -838,6 +860,10 @@ MaybeHandle<SharedFunctionInfo> FinalizeTopLevel(
     script->set_compilation_state(Script::COMPILATION_STATE_COMPILED);
   }
 
+  if (FLAG_parallel_compile_top_level_functions) {
+    EnqueueParallelCompileCandidates(parse_info, isolate);
+  }
+
   return shared_info;
 }
 
@@ -910,7 +936,8 @@ std::unique_ptr<UnoptimizedCompilationJob> CompileTopLevelOnBackgroundThread(
 
 class BackgroundCompileTask : public ScriptCompiler::ScriptStreamingTask {
  public:
-  BackgroundCompileTask(ScriptStreamingData* source, Isolate* isolate);
+  BackgroundCompileTask(ScriptStreamingData* source, Isolate* isolate,
+                        bool is_module);
 
   virtual void Run();
 
@@ -924,7 +951,7 @@ class BackgroundCompileTask : public ScriptCompiler::ScriptStreamingTask {
 };
 
 BackgroundCompileTask::BackgroundCompileTask(ScriptStreamingData* source,
-                                             Isolate* isolate)
+                                             Isolate* isolate, bool is_module)
     : source_(source),
       stack_size_(i::FLAG_stack_size),
       timer_(isolate->counters()->compile_script_on_background()) {
@@ -940,6 +967,7 @@ BackgroundCompileTask::BackgroundCompileTask(ScriptStreamingData* source,
     info->set_runtime_call_stats(nullptr);
   }
   info->set_toplevel();
+  if (is_module) info->set_module();
   std::unique_ptr<Utf16CharacterStream> stream(
       ScannerStream::For(source->source_stream.get(), source->encoding,
                          info->runtime_call_stats()));
@@ -1786,8 +1814,8 @@ MaybeHandle<JSFunction> Compiler::GetWrappedFunction(
 }
 
 ScriptCompiler::ScriptStreamingTask* Compiler::NewBackgroundCompileTask(
-    ScriptStreamingData* source, Isolate* isolate) {
-  return new BackgroundCompileTask(source, isolate);
+    ScriptStreamingData* source, Isolate* isolate, bool is_module) {
+  return new BackgroundCompileTask(source, isolate, is_module);
 }
 
 MaybeHandle<SharedFunctionInfo>
@@ -1804,6 +1832,7 @@ Compiler::GetSharedFunctionInfoForStreamedScript(
   isolate->counters()->total_compile_size()->Increment(source_length);
 
   ParseInfo* parse_info = streaming_data->info.get();
+  DCHECK_EQ(origin_options.IsModule(), parse_info->is_module());
   parse_info->UpdateBackgroundParseStatisticsOnMainThread(isolate);
 
   // Check if compile cache already holds the SFI, if so no need to finalize
@@ -60,11 +60,12 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
   static MaybeHandle<JSArray> CompileForLiveEdit(Handle<Script> script);
 
   // Creates a new task that when run will parse and compile the streamed
-  // script associated with |streaming_data| and can be finalized with
+  // script (or module, if |is_module| is set) associated with
+  // |streaming_data| and can be finalized with
   // Compiler::GetSharedFunctionInfoForStreamedScript.
   // Note: does not take ownership of streaming_data.
   static ScriptCompiler::ScriptStreamingTask* NewBackgroundCompileTask(
-      ScriptStreamingData* streaming_data, Isolate* isolate);
+      ScriptStreamingData* streaming_data, Isolate* isolate, bool is_module);
 
   // Generate and install code from previously queued compilation job.
   static bool FinalizeCompilationJob(UnoptimizedCompilationJob* job,
@@ -2691,6 +2691,56 @@ Node* EffectControlLinearizer::LowerNewConsString(Node* node) {
   Node* second_instance_type =
       __ LoadField(AccessBuilder::ForMapInstanceType(), second_map);
 
+  // If {first} is a ConsString more than twice as long as {second} whose
+  // second part is at most twice as long as {second}, let the NewConsString
+  // builtin join those two first to keep the tree balanced (see
+  // Factory::NewConsString).
+  auto if_cons = __ MakeLabel();
+  auto if_long = __ MakeLabel();
+  auto if_balance = __ MakeLabel();
+  auto if_allocate = __ MakeLabel();
+  auto done_result = __ MakeLabel(MachineRepresentation::kTaggedPointer);
+  Node* first_representation = __ Word32And(
+      first_instance_type, __ Int32Constant(kStringRepresentationMask));
+  __ Branch(
+      __ Word32Equal(first_representation, __ Int32Constant(kConsStringTag)),
+      &if_cons, &if_allocate);
+
+  __ Bind(&if_cons);
+  Node* second_length =
+      ChangeSmiToIntPtr(__ LoadField(AccessBuilder::ForStringLength(), second));
+  Node* twice_second_length = __ IntAdd(second_length, second_length);
+  Node* first_length =
+      ChangeSmiToIntPtr(__ LoadField(AccessBuilder::ForStringLength(), first));
+  __ Branch(__ IntLessThan(twice_second_length, first_length), &if_long,
+            &if_allocate);
+
+  __ Bind(&if_long);
+  {
+    Node* first_second =
+        __ LoadField(AccessBuilder::ForConsStringSecond(), first);
+    Node* first_second_length = ChangeSmiToIntPtr(
+        __ LoadField(AccessBuilder::ForStringLength(), first_second));
+    __ Branch(__ IntLessThan(twice_second_length, first_second_length),
+              &if_allocate, &if_balance);
+  }
+
+  __ Bind(&if_balance);
+  {
+    Callable const callable =
+        Builtins::CallableFor(isolate(), Builtins::kNewConsString);
+    Operator::Properties properties = Operator::kEliminatable;
+    CallDescriptor::Flags flags = CallDescriptor::kNoFlags;
+    auto call_descriptor = Linkage::GetStubCallDescriptor(
+        isolate(), graph()->zone(), callable.descriptor(), 0, flags,
+        properties);
+    __ Goto(&done_result,
+            __ Call(call_descriptor, __ HeapConstant(callable.code()), length,
+                    first, second, __ NoContextConstant()));
+  }
+
+  __ Bind(&if_allocate);
+
   // Determine the proper map for the resulting ConsString.
   // If both {first} and {second} are one-byte strings, we
   // create a new ConsOneByteString, otherwise we create a
@@ -2721,7 +2771,10 @@ Node* EffectControlLinearizer::LowerNewConsString(Node* node) {
   __ StoreField(AccessBuilder::ForStringLength(), result, length);
   __ StoreField(AccessBuilder::ForConsStringFirst(), result, first);
   __ StoreField(AccessBuilder::ForConsStringSecond(), result, second);
-  return result;
+  __ Goto(&done_result, result);
+
+  __ Bind(&done_result);
+  return done_result.PhiAt(0);
 }
 
 Node* EffectControlLinearizer::LowerArrayBufferWasNeutered(Node* node) {
@@ -3494,6 +3494,10 @@ Reduction JSCallReducer::ReduceJSCall(Node* node,
       return ReduceStringPrototypeIterator(node);
     case Builtins::kStringIteratorPrototypeNext:
       return ReduceStringIteratorPrototypeNext(node);
+    case Builtins::kRegExpPrototypeExec:
+      return ReduceRegExpPrototypeExecOrTest(node, Builtins::kRegExpExecString);
+    case Builtins::kRegExpPrototypeTest:
+      return ReduceRegExpPrototypeExecOrTest(node, Builtins::kRegExpTestString);
     case Builtins::kStringPrototypeConcat:
       return ReduceStringPrototypeConcat(node, shared);
     case Builtins::kTypedArrayPrototypeEntries:
@@ -5207,6 +5211,156 @@ Reduction JSCallReducer::ReduceStringPrototypeConcat(
   return Replace(value);
 }
 
+namespace {
+
+// Returns true if the value of {node} is only used as a condition.
+bool IsOnlyTestedForTruthiness(Node* node) {
+  for (Edge edge : node->use_edges()) {
+    if (NodeProperties::IsValueEdge(edge) &&
+        edge.from()->opcode() != IrOpcode::kToBoolean) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Returns true if {node} only flows into the frame state of {checkpoint},
+// through nodes that each have a single use.
+bool OnlyFeedsCheckpoint(Node* node, Node* checkpoint) {
+  while (node->UseCount() == 1) {
+    Node* user = *node->uses().begin();
+    if (user == checkpoint) return true;
+    if (user->opcode() != IrOpcode::kStateValues &&
+        user->opcode() != IrOpcode::kTypedStateValues &&
+        user->opcode() != IrOpcode::kFrameState) {
+      return false;
+    }
+    node = user;
+  }
+  return false;
+}
+
+// Returns the load of element 0 from the value of {node} if that is its only
+// use and directly follows {node}, as in {re.exec(s)[0]}, or nullptr
+// otherwise. The load is preceded by a checkpoint, whose frame state is the
+// only other place the value may occur.
+Node* FindOnlyFirstElementLoad(Node* node) {
+  Node* load = nullptr;
+  for (Edge edge : node->use_edges()) {
+    if (!NodeProperties::IsValueEdge(edge)) continue;
+    Node* user = edge.from();
+    if (user->opcode() == IrOpcode::kJSLoadProperty && edge.index() == 0) {
+      if (load != nullptr) return nullptr;
+      load = user;
+    }
+  }
+  if (load == nullptr) return nullptr;
+  if (NodeProperties::IsExceptionalCall(load)) return nullptr;
+  NumberMatcher key(NodeProperties::GetValueInput(load, 1));
+  if (!key.Is(0)) return nullptr;
+  Node* checkpoint = NodeProperties::GetEffectInput(load);
+  if (checkpoint->opcode() != IrOpcode::kCheckpoint ||
+      checkpoint->UseCount() != 1 ||
+      NodeProperties::GetEffectInput(checkpoint) != node ||
+      NodeProperties::GetControlInput(load) != node) {
+    return nullptr;
+  }
+  for (Edge edge : node->use_edges()) {
+    if (!NodeProperties::IsValueEdge(edge) || edge.from() == load) continue;
+    if (!OnlyFeedsCheckpoint(edge.from(), checkpoint)) return nullptr;
+  }
+  return load;
+}
+
+}  // namespace
+
+// ES #sec-regexp.prototype.exec
+// ES #sec-regexp.prototype.test
+Reduction JSCallReducer::ReduceRegExpPrototypeExecOrTest(
+    Node* node, Builtins::Name builtin) {
+  DCHECK_EQ(IrOpcode::kJSCall, node->opcode());
+  CallParameters const& p = CallParametersOf(node->op());
+  if (p.speculation_mode() == SpeculationMode::kDisallowSpeculation) {
+    return NoChange();
+  }
+  if (node->op()->ValueInputCount() < 3) return NoChange();
+
+  // The builtins can throw, and we don't wire up exception edges for them.
+  if (NodeProperties::IsExceptionalCall(node)) return NoChange();
+
+  Node* receiver = NodeProperties::GetValueInput(node, 1);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+  Node* context = NodeProperties::GetContextInput(node);
+
+  // Check that the {receiver} is known to be a JSRegExp, which takes care of
+  // the receiver checks in the builtins.
+  ZoneHandleSet<Map> receiver_maps;
+  NodeProperties::InferReceiverMapsResult result =
+      NodeProperties::InferReceiverMaps(receiver, effect, &receiver_maps);
+  if (result == NodeProperties::kNoReceiverMaps) return NoChange();
+  for (Handle<Map> receiver_map : receiver_maps) {
+    if (receiver_map->instance_type() != JS_REGEXP_TYPE) return NoChange();
+  }
+
+  // If the {receiver_maps} aren't reliable, we need to repeat the
+  // map check here, guarded by the CALL_IC.
+  if (result == NodeProperties::kUnreliableReceiverMaps) {
+    effect =
+        graph()->NewNode(simplified()->CheckMaps(CheckMapsFlag::kNone,
+                                                 receiver_maps, p.feedback()),
+                         receiver, effect, control);
+  }
+
+  // Take care of the ToString conversion of the argument by speculating
+  // that it is a String already.
+  Node* string = effect =
+      graph()->NewNode(simplified()->CheckString(p.feedback()),
+                       NodeProperties::GetValueInput(node, 2), effect, control);
+
+  // If the result of exec is only tested for truthiness or only indexed with
+  // [0], there's no need to allocate it. The match still has to update
+  // lastIndex and the last match info though, since those are observable
+  // (via RegExp.lastMatch and friends).
+  Node* first_element_load = nullptr;
+  if (builtin == Builtins::kRegExpExecString) {
+    if (IsOnlyTestedForTruthiness(node)) {
+      // The result is either null or an array, so its truthiness is whether
+      // the match succeeded, which is what this builtin returns.
+      builtin = Builtins::kRegExpExecStringWithoutResult;
+    } else {
+      first_element_load = FindOnlyFirstElementLoad(node);
+      if (first_element_load != nullptr) {
+        builtin = Builtins::kRegExpExecStringFirstMatch;
+      }
+    }
+  }
+
+  // When the call replaces the load of element 0 as well, it produces the
+  // value of the load and so lazily deoptimizes to the state after it.
+  Node* frame_state = NodeProperties::GetFrameStateInput(
+      first_element_load != nullptr ? first_element_load : node);
+  Callable const callable = Builtins::CallableFor(isolate(), builtin);
+  auto call_descriptor = Linkage::GetStubCallDescriptor(
+      isolate(), graph()->zone(), callable.descriptor(), 0,
+      CallDescriptor::kNeedsFrameState, Operator::kNoProperties);
+  Node* value = effect = control = graph()->NewNode(
+      common()->Call(call_descriptor), jsgraph()->HeapConstant(callable.code()),
+      receiver, string, context, frame_state, effect, control);
+
+  if (first_element_load != nullptr) {
+    // The checkpoint before the load is the only other user of the result,
+    // and nothing can deoptimize to it anymore.
+    Node* checkpoint = NodeProperties::GetEffectInput(first_element_load);
+    ReplaceWithValue(first_element_load, value, effect, control);
+    first_element_load->Kill();
+    checkpoint->Kill();
+  }
+
+  ReplaceWithValue(node, value, effect, control);
+  return Replace(value);
+}
+
 Reduction JSCallReducer::ReduceAsyncFunctionPromiseCreate(Node* node) {
   DCHECK_EQ(IrOpcode::kJSCall, node->opcode());
   Node* context = NodeProperties::GetContextInput(node);
@@ -128,6 +128,9 @@ class V8_EXPORT_PRIVATE JSCallReducer final : public AdvancedReducer {
   Reduction ReduceStringPrototypeConcat(Node* node,
                                         Handle<SharedFunctionInfo> shared);
 
+  Reduction ReduceRegExpPrototypeExecOrTest(Node* node,
+                                            Builtins::Name builtin);
+
   Reduction ReduceAsyncFunctionPromiseCreate(Node* node);
   Reduction ReduceAsyncFunctionPromiseRelease(Node* node);
   Reduction ReducePromiseCapabilityDefaultReject(Node* node);
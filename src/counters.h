@@ -721,6 +721,8 @@ class RuntimeCallTimer final {
   V(Int32Array_New)                                        \
   V(Int8Array_New)                                         \
   V(JSON_Parse)                                            \
+  V(JSON_StreamingParser_Feed)                             \
+  V(JSON_StreamingParser_Finish)                           \
   V(JSON_Stringify)                                        \
   V(Map_AsArray)                                           \
   V(Map_Clear)                                             \
@@ -794,6 +796,7 @@ class RuntimeCallTimer final {
   V(RegExp_New)                                            \
   V(ScriptCompiler_Compile)                                \
   V(ScriptCompiler_CompileFunctionInContext)               \
+  V(ScriptCompiler_CompileModule)                          \
   V(ScriptCompiler_CompileUnbound)                         \
   V(Script_Run)                                            \
   V(Set_Add)                                               \
@@ -1175,6 +1178,10 @@ class RuntimeCallTimerScope {
   /* Compilation times. */                                                     \
   HT(compile, V8.CompileMicroSeconds, 1000000, MICROSECOND)                    \
   HT(compile_eval, V8.CompileEvalMicroSeconds, 1000000, MICROSECOND)           \
+  HT(compile_regexp_bytecode, V8.CompileRegExpBytecodeMicroSeconds, 1000000,   \
+     MICROSECOND)                                                              \
+  HT(compile_regexp_native, V8.CompileRegExpNativeMicroSeconds, 1000000,       \
+     MICROSECOND)                                                              \
   /* Serialization as part of compilation (code caching) */                    \
   HT(compile_serialize, V8.CompileSerializeMicroSeconds, 100000, MICROSECOND)  \
   HT(compile_deserialize, V8.CompileDeserializeMicroSeconds, 1000000,          \
@@ -1351,6 +1358,12 @@ class RuntimeCallTimerScope {
   SC(sub_string_native, V8.SubStringNative)                                    \
   SC(regexp_entry_runtime, V8.RegExpEntryRuntime)                              \
   SC(regexp_entry_native, V8.RegExpEntryNative)                                \
+  SC(regexp_bytecode_compiled, V8.RegExpBytecodeCompiled)                      \
+  SC(regexp_bytecode_size, V8.RegExpBytecodeSize)                              \
+  SC(regexp_bytecode_cache_hits, V8.RegExpBytecodeCacheHits)                   \
+  SC(regexp_native_compiled, V8.RegExpNativeCompiled)                          \
+  SC(regexp_native_code_size, V8.RegExpNativeCodeSize)                         \
+  SC(regexp_tier_ups, V8.RegExpTierUps)                                        \
   SC(number_to_string_native, V8.NumberToStringNative)                         \
   SC(number_to_string_runtime, V8.NumberToStringRuntime)                       \
   SC(math_exp_runtime, V8.MathExpRuntime)                                      \
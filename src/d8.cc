@@ -486,6 +486,8 @@ bool CounterMap::Match(void* key1, void* key2) {
   return strcmp(name1, name2) == 0;
 }
 
+static char* ReadChars(const char* name, int* size_out);
+
 // Dummy external source stream which returns the whole source in one go.
 class DummySourceStream : public v8::ScriptCompiler::ExternalSourceStream {
  public:
@@ -534,6 +536,129 @@ class BackgroundCompileThread : public base::Thread {
   std::unique_ptr<v8::ScriptCompiler::ScriptStreamingTask> task_;
 };
 
+// External source stream which reads a file on the thread that streams it
+// and returns the whole contents in one go. A copy of the contents is kept,
+// as the main thread needs the full source string to finish compilation.
+class FileSourceStream : public v8::ScriptCompiler::ExternalSourceStream {
+ public:
+  explicit FileSourceStream(const std::string& file_name)
+      : file_name_(file_name), length_(0), done_(false) {}
+
+  size_t GetMoreData(const uint8_t** src) override {
+    if (done_) {
+      return 0;
+    }
+    done_ = true;
+    int length = 0;
+    chars_.reset(ReadChars(file_name_.c_str(), &length));
+    if (!chars_ || length == 0) {
+      return 0;
+    }
+    length_ = length;
+    uint8_t* data = new uint8_t[length_];
+    memcpy(data, chars_.get(), length_);
+    *src = data;
+    return length_;
+  }
+
+  // Returns the streamed source, or an empty handle if the file could not be
+  // read. Only valid once streaming has finished.
+  MaybeLocal<String> GetSource(Isolate* isolate) const {
+    DCHECK(done_);
+    if (!chars_) return MaybeLocal<String>();
+    const char* chars = chars_.get();
+    int length = static_cast<int>(length_);
+    // The streaming decoder drops a leading byte order mark, so the full
+    // source must not contain it either.
+    if (length >= 3 && memcmp(chars, "\xEF\xBB\xBF", 3) == 0) {
+      chars += 3;
+      length -= 3;
+    }
+    return String::NewFromUtf8(isolate, chars, NewStringType::kNormal, length);
+  }
+
+ private:
+  std::string file_name_;
+  std::unique_ptr<char[]> chars_;
+  size_t length_;
+  bool done_;
+};
+
+// A module file which is read, parsed and compiled on a worker thread. The
+// compilation is finished on the main thread by Finalize, which waits for
+// the worker thread if necessary.
+class StreamedModuleLoad {
+ public:
+  StreamedModuleLoad(Isolate* isolate, const std::string& file_name)
+      : file_name_(file_name),
+        source_stream_(new FileSourceStream(file_name)),
+        streamed_source_(source_stream_,
+                         v8::ScriptCompiler::StreamedSource::UTF8),
+        task_(v8::ScriptCompiler::StartStreamingModule(isolate,
+                                                       &streamed_source_)),
+        done_(0),
+        pending_(false) {}
+
+  ~StreamedModuleLoad() { Wait(); }
+
+  // Posts the streaming task to a worker thread. Returns false if the module
+  // can't be streamed, in which case it has to be loaded synchronously.
+  bool Start() {
+    if (!task_) return false;
+    pending_ = true;
+    g_platform->CallOnWorkerThread(
+        std::unique_ptr<Task>(new StreamingTask(this)));
+    return true;
+  }
+
+  MaybeLocal<Module> Finalize(Local<Context> context) {
+    Isolate* isolate = context->GetIsolate();
+    Wait();
+    Local<String> source_text;
+    if (!source_stream_->GetSource(isolate).ToLocal(&source_text)) {
+      std::string msg = "Error reading: " + file_name_;
+      Throw(isolate, msg.c_str());
+      return MaybeLocal<Module>();
+    }
+    ScriptOrigin origin(
+        String::NewFromUtf8(isolate, file_name_.c_str(), NewStringType::kNormal)
+            .ToLocalChecked(),
+        Local<Integer>(), Local<Integer>(), Local<Boolean>(), Local<Integer>(),
+        Local<Value>(), Local<Boolean>(), Local<Boolean>(), True(isolate));
+    return ScriptCompiler::CompileModule(context, &streamed_source_,
+                                         source_text, origin);
+  }
+
+ private:
+  class StreamingTask : public Task {
+   public:
+    explicit StreamingTask(StreamedModuleLoad* load) : load_(load) {}
+
+    void Run() override {
+      load_->task_->Run();
+      load_->done_.Signal();
+    }
+
+   private:
+    StreamedModuleLoad* load_;
+  };
+
+  void Wait() {
+    if (!pending_) return;
+    done_.Wait();
+    pending_ = false;
+  }
+
+  std::string file_name_;
+  FileSourceStream* source_stream_;  // Owned by streamed_source_.
+  v8::ScriptCompiler::StreamedSource streamed_source_;
+  std::unique_ptr<v8::ScriptCompiler::ScriptStreamingTask> task_;
+  base::Semaphore done_;
+  bool pending_;
+
+  DISALLOW_COPY_AND_ASSIGN(StreamedModuleLoad);
+};
+
 ScriptCompiler::CachedData* Shell::LookupCodeCache(Isolate* isolate,
                                                    Local<Value> source) {
   base::LockGuard<base::Mutex> lock_guard(cached_code_mutex_.Pointer());
@@ -805,6 +930,15 @@ MaybeLocal<Module> Shell::FetchModuleTree(Local<Context> context,
                                           const std::string& file_name) {
   DCHECK(IsAbsolutePath(file_name));
   Isolate* isolate = context->GetIsolate();
+  if (options.stream_modules) {
+    StreamedModuleLoadMap loads;
+    std::unique_ptr<StreamedModuleLoad> load(
+        new StreamedModuleLoad(isolate, file_name));
+    if (load->Start()) {
+      loads.insert(std::make_pair(file_name, std::move(load)));
+      return FetchStreamedModuleTree(context, file_name, &loads);
+    }
+  }
   Local<String> source_text = ReadFile(isolate, file_name.c_str());
   if (source_text.IsEmpty()) {
     std::string msg = "Error reading: " + file_name;
@@ -846,6 +980,62 @@ MaybeLocal<Module> Shell::FetchModuleTree(Local<Context> context,
   return module;
 }
 
+MaybeLocal<Module> Shell::FetchStreamedModuleTree(
+    Local<Context> context, const std::string& file_name,
+    StreamedModuleLoadMap* loads) {
+  Isolate* isolate = context->GetIsolate();
+  Local<Module> module;
+  {
+    auto load_it = loads->find(file_name);
+    CHECK(load_it != loads->end());
+    bool compiled = load_it->second->Finalize(context).ToLocal(&module);
+    loads->erase(load_it);
+    if (!compiled) return MaybeLocal<Module>();
+  }
+
+  ModuleEmbedderData* d = GetModuleDataFromContext(context);
+  CHECK(d->specifier_to_module_map
+            .insert(std::make_pair(file_name, Global<Module>(isolate, module)))
+            .second);
+  CHECK(d->module_to_specifier_map
+            .insert(std::make_pair(Global<Module>(isolate, module), file_name))
+            .second);
+
+  std::string dir_name = DirName(file_name);
+  int length = module->GetModuleRequestsLength();
+  std::vector<std::string> requests;
+  requests.reserve(length);
+  for (int i = 0; i < length; ++i) {
+    Local<String> name = module->GetModuleRequest(i);
+    requests.push_back(NormalizePath(ToSTLString(isolate, name), dir_name));
+  }
+
+  // Start loading all newly discovered modules before finalizing any of
+  // them, so that they are read and parsed while the main thread works on
+  // their siblings. The graph is still finalized depth-first in request
+  // order, which keeps errors the same as when loading synchronously.
+  for (const std::string& absolute_path : requests) {
+    if (d->specifier_to_module_map.count(absolute_path) ||
+        loads->count(absolute_path)) {
+      continue;
+    }
+    std::unique_ptr<StreamedModuleLoad> load(
+        new StreamedModuleLoad(isolate, absolute_path));
+    CHECK(load->Start());
+    loads->insert(std::make_pair(absolute_path, std::move(load)));
+  }
+
+  for (const std::string& absolute_path : requests) {
+    if (!d->specifier_to_module_map.count(absolute_path)) {
+      if (FetchStreamedModuleTree(context, absolute_path, loads).IsEmpty()) {
+        return MaybeLocal<Module>();
+      }
+    }
+  }
+
+  return module;
+}
+
 namespace {
 
 struct DynamicImportData {
@@ -2761,6 +2951,9 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strcmp(argv[i], "--stress-deopt") == 0) {
       options.stress_deopt = true;
       argv[i] = nullptr;
+    } else if (strcmp(argv[i], "--stream-modules") == 0) {
+      options.stream_modules = true;
+      argv[i] = nullptr;
     } else if (strcmp(argv[i], "--stress-background-compile") == 0) {
       options.stress_background_compile = true;
       argv[i] = nullptr;
@@ -3037,7 +3230,10 @@ class Serializer : public ValueSerializer::Delegate {
   explicit Serializer(Isolate* isolate)
       : isolate_(isolate),
         serializer_(isolate, this),
-        current_memory_usage_(0) {}
+        current_memory_usage_(0) {
+    // Messages are only ever read by workers of this same process.
+    serializer_.SetUseCompactEncoding(true);
+  }
 
   Maybe<bool> WriteValue(Local<Context> context, Local<Value> value,
                          Local<Value> transfer) {
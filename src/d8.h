@@ -21,6 +21,7 @@
 
 namespace v8 {
 
+class StreamedModuleLoad;
 
 // A single counter in a counter collection.
 class Counter {
@@ -304,6 +305,7 @@ class ShellOptions {
         num_isolates(1),
         compile_options(v8::ScriptCompiler::kNoCompileOptions),
         stress_background_compile(false),
+        stream_modules(false),
         code_cache_options(CodeCacheOptions::kNoProduceCache),
         isolate_sources(nullptr),
         icu_data_file(nullptr),
@@ -340,6 +342,7 @@ class ShellOptions {
   int num_isolates;
   v8::ScriptCompiler::CompileOptions compile_options;
   bool stress_background_compile;
+  bool stream_modules;
   CodeCacheOptions code_cache_options;
   SourceGroup* isolate_sources;
   const char* icu_data_file;
@@ -523,8 +526,15 @@ class Shell : public i::AllStatic {
       v8::MaybeLocal<Value> global_object);
   static void DisposeRealm(const v8::FunctionCallbackInfo<v8::Value>& args,
                            int index);
+  // Modules which are being loaded in the background, by absolute path.
+  typedef std::map<std::string, std::unique_ptr<StreamedModuleLoad>>
+      StreamedModuleLoadMap;
+
   static MaybeLocal<Module> FetchModuleTree(v8::Local<v8::Context> context,
                                             const std::string& file_name);
+  static MaybeLocal<Module> FetchStreamedModuleTree(
+      v8::Local<v8::Context> context, const std::string& file_name,
+      StreamedModuleLoadMap* loads);
   static ScriptCompiler::CachedData* LookupCodeCache(Isolate* isolate,
                                                      Local<Value> name);
   static void StoreInCodeCache(Isolate* isolate, Local<Value> name,
@@ -349,6 +349,7 @@ bool IntrinsicHasNoSideEffect(Runtime::FunctionId id) {
   V(HasComplexElements)                  \
   V(NewArray)                            \
   V(NormalizeElements)                   \
+  V(TryJoinSimpleElements)               \
   V(TrySliceSimpleNonFastElements)       \
   V(TypedArrayGetBuffer)                 \
   /* Errors */                           \
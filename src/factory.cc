@@ -450,9 +450,9 @@ MaybeHandle<String> Factory::NewStringFromUtf8(Vector<const char> string,
 
   // Copy ASCII portion.
   uint16_t* data = result->GetChars();
-  for (int i = 0; i < non_ascii_start; i++) {
-    *data++ = *ascii_data++;
-  }
+  CopyChars(data, reinterpret_cast<const uint8_t*>(ascii_data),
+            non_ascii_start);
+  data += non_ascii_start;
 
   // Now write the remainder.
   decoder->WriteUtf16(data, utf16_length, non_ascii);
@@ -495,9 +495,9 @@ MaybeHandle<String> Factory::NewStringFromUtf8SubString(
 
   // Copy ASCII portion.
   uint16_t* data = result->GetChars();
-  for (int i = 0; i < non_ascii_start; i++) {
-    *data++ = *ascii_data++;
-  }
+  CopyChars(data, reinterpret_cast<const uint8_t*>(ascii_data),
+            non_ascii_start);
+  data += non_ascii_start;
 
   // Now write the remainder.
   decoder->WriteUtf16(data, utf16_length, non_ascii);
@@ -775,6 +775,44 @@ MaybeHandle<String> Factory::NewConsString(Handle<String> left,
     THROW_NEW_ERROR(isolate(), NewInvalidStringLengthError(), String);
   }
 
+  // Repeated concatenation would build a left-leaning chain, as deep as the
+  // number of parts, that makes indexing and traversal linear and flattening
+  // recursive. Instead, while {left} is an unflattened cons string more than
+  // twice as long as {right} whose second part is at most twice as long as
+  // {right}, join that part with {right} first, like a carry in a binary
+  // counter. The right spine then holds subtrees of geometrically shrinking
+  // length and the tree stays logarithmically deep, while joining two trees
+  // of similar length leaves both intact.
+  // CodeStubAssembler::NewConsString does the same for generated code.
+  if (length >= ConsString::kMinLength) {
+    while (left->IsConsString() && !left->IsFlat() &&
+           left_length > 2 * right_length) {
+      Handle<ConsString> cons = Handle<ConsString>::cast(left);
+      Handle<String> second(cons->second(), isolate());
+      if (second->length() > 2 * right_length) break;
+      if (second->IsThinString()) {
+        second = handle(Handle<ThinString>::cast(second)->actual(), isolate());
+      }
+      int pair_length = second->length() + right_length;
+      if (pair_length < ConsString::kMinLength) {
+        // Short pairs are flat, so this doesn't balance any further.
+        right = NewConsString(second, right).ToHandleChecked();
+      } else {
+        bool pair_one_byte = (second->IsOneByteRepresentation() &&
+                              right->IsOneByteRepresentation()) ||
+                             (second->HasOnlyOneByteChars() &&
+                              right->HasOnlyOneByteChars());
+        right = NewConsString(second, right, pair_length, pair_one_byte);
+      }
+      right_length = pair_length;
+      left = handle(cons->first(), isolate());
+      if (left->IsThinString()) {
+        left = handle(Handle<ThinString>::cast(left)->actual(), isolate());
+      }
+      left_length = left->length();
+    }
+  }
+
   bool left_is_one_byte = left->IsOneByteRepresentation();
   bool right_is_one_byte = right->IsOneByteRepresentation();
   bool is_one_byte = left_is_one_byte && right_is_one_byte;
@@ -2952,6 +2990,12 @@ void Factory::SetRegExpIrregexpData(Handle<JSRegExp> regexp,
   store->set(JSRegExp::kIrregexpCaptureCountIndex,
              Smi::FromInt(capture_count));
   store->set(JSRegExp::kIrregexpCaptureNameMapIndex, uninitialized);
+  int ticks_until_tier_up = FLAG_regexp_tier_up ? FLAG_regexp_tier_up_ticks : 0;
+  store->set(JSRegExp::kIrregexpTicksUntilTierUpIndex,
+             Smi::FromInt(Max(ticks_until_tier_up, 0)));
+  store->set(JSRegExp::kIrregexpRequiredLiteralIndex, Smi::kZero);
+  store->set(JSRegExp::kIrregexpRequiredLiteralMinOffsetIndex, Smi::kZero);
+  store->set(JSRegExp::kIrregexpRequiredLiteralMaxOffsetIndex, Smi::kZero);
   regexp->set_data(*store);
 }
 
@@ -881,6 +881,13 @@ DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 
 // compiler-dispatcher.cc
 DEFINE_BOOL(compiler_dispatcher, false, "enable compiler dispatcher")
+DEFINE_BOOL(parallel_compile_top_level_functions, false,
+            "parse and compile large lazy top-level functions on background "
+            "threads using the compiler dispatcher")
+DEFINE_IMPLICATION(parallel_compile_top_level_functions, compiler_dispatcher)
+DEFINE_INT(parallel_compile_min_function_size, 4 * KB,
+           "minimum source size of a top-level function for it to be "
+           "compiled in parallel")
 DEFINE_BOOL(trace_compiler_dispatcher, false,
             "trace compiler dispatcher activity")
 
@@ -977,6 +984,12 @@ DEFINE_BOOL(lazy_inner_functions, true, "enable lazy parsing inner functions")
 DEFINE_BOOL(aggressive_lazy_inner_functions, false,
             "even lazier inner function parsing")
 DEFINE_IMPLICATION(aggressive_lazy_inner_functions, lazy_inner_functions)
+DEFINE_BOOL(json_literal_initializers, true,
+            "skip large JSON object and array initializers of top-level "
+            "declarations while parsing and create them with the JSON parser")
+DEFINE_INT(json_literal_initializer_min_size, 8 * KB,
+           "minimum source size of a top-level initializer for it to be "
+           "created with the JSON parser")
 DEFINE_BOOL(preparser_scope_analysis, true,
             "perform scope analysis for preparsed inner functions")
 DEFINE_IMPLICATION(preparser_scope_analysis, aggressive_lazy_inner_functions)
@@ -1056,6 +1069,23 @@ DEFINE_BOOL(serialization_statistics, false,
 // Regexp
 DEFINE_BOOL(regexp_optimization, true, "generate optimized regexp code")
 DEFINE_BOOL(regexp_mode_modifiers, false, "enable inline flags in regexp.")
+DEFINE_BOOL(regexp_linear, false,
+            "match regexps without backreferences or lookarounds in linear "
+            "time")
+DEFINE_BOOL(regexp_linear_nested_quantifiers, false,
+            "match regexps with nested quantifiers in linear time if possible")
+DEFINE_BOOL(regexp_tier_up, true,
+            "interpret regexps first and compile them to native code only "
+            "once they are hot")
+DEFINE_INT(regexp_tier_up_ticks, 1,
+           "number of interpreted executions before a regexp is compiled to "
+           "native code")
+DEFINE_BOOL(regexp_required_literal, true,
+            "skip ahead to the occurrences of a literal that every regexp "
+            "match contains")
+DEFINE_INT(regexp_bytecode_cache_size, 1024,
+           "maximum size of the regexp bytecode shared by all isolates of "
+           "the process (in KB), 0 disables sharing")
 
 // Testing flags test/cctest/test-{flags,api,serialization}.cc
 DEFINE_BOOL(testing_bool_flag, true, "testing_bool_flag")
@@ -1330,6 +1360,7 @@ DEFINE_BOOL(single_threaded, false, "disable the use of background tasks")
 DEFINE_IMPLICATION(single_threaded, single_threaded_gc)
 DEFINE_NEG_IMPLICATION(single_threaded, concurrent_recompilation)
 DEFINE_NEG_IMPLICATION(single_threaded, compiler_dispatcher)
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_top_level_functions)
 
 //
 // Parallel and concurrent GC (Orinoco) related flags.
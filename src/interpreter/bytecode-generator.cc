@@ -4242,6 +4242,21 @@ void BytecodeGenerator::VisitGetTemplateObject(GetTemplateObject* expr) {
   builder()->GetTemplateObject(entry, feedback_index(literal_slot));
 }
 
+void BytecodeGenerator::VisitJsonLiteral(JsonLiteral* expr) {
+  builder()->SetExpressionPosition(expr);
+  FeedbackSlot literal_slot = feedback_spec()->AddLiteralSlot();
+  RegisterList args = register_allocator()->NewRegisterList(4);
+  builder()
+      ->MoveRegister(Register::function_closure(), args[0])
+      .LoadLiteral(Smi::FromInt(feedback_index(literal_slot)))
+      .StoreAccumulatorInRegister(args[1])
+      .LoadLiteral(Smi::FromInt(expr->position()))
+      .StoreAccumulatorInRegister(args[2])
+      .LoadLiteral(Smi::FromInt(expr->end_position()))
+      .StoreAccumulatorInRegister(args[3])
+      .CallRuntime(Runtime::kCreateJsonLiteral, args);
+}
+
 void BytecodeGenerator::VisitTemplateLiteral(TemplateLiteral* expr) {
   const TemplateLiteral::StringList& parts = *expr->string_parts();
   const TemplateLiteral::ExpressionList& substitutions = *expr->substitutions();
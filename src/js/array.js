@@ -168,6 +168,13 @@ function Join(array, length, separator, use_locale) {
     // If the array is cyclic, return the empty string for already
     // visited arrays.
     if (StackHas(visited_arrays, array)) return '';
+
+    // Arrays of strings and numbers can't be cyclic and are joined in one go.
+    if (!use_locale) {
+      var result = %TryJoinSimpleElements(array, length, separator);
+      if (IS_STRING(result)) return result;
+    }
+
     StackPush(visited_arrays, array);
   }
 
@@ -666,10 +673,12 @@ function ArraySpliceFallback(start, delete_count) {
 
 
 function InnerArraySort(array, length, comparefn) {
-  // In-place QuickSort algorithm.
-  // For short (length <= 10) arrays, insertion sort is used for efficiency.
+  // Stable merge sort of runs that are sorted by insertion sort first.
+  // Without a comparison function, arrays of numbers and strings are sorted
+  // natively.
 
-  if (!IS_CALLABLE(comparefn)) {
+  var use_default_comparefn = !IS_CALLABLE(comparefn);
+  if (use_default_comparefn) {
     comparefn = function (x, y) {
       if (x === y) return 0;
       if (%_IsSmi(x) && %_IsSmi(y)) {
@@ -681,6 +690,9 @@ function InnerArraySort(array, length, comparefn) {
       else return x < y ? -1 : 1;
     };
   }
+  // Both InsertionSort and Merge keep a[] a permutation of its elements
+  // whenever comparefn is called, so that a comparison function that throws
+  // leaves no element lost or duplicated.
   function InsertionSort(a, from, to) {
     for (var i = from + 1; i < to; i++) {
       var element = a[i];
@@ -689,115 +701,57 @@ function InnerArraySort(array, length, comparefn) {
         var order = comparefn(tmp, element);
         if (order > 0) {
           a[j + 1] = tmp;
+          a[j] = element;
         } else {
           break;
         }
       }
-      a[j + 1] = element;
     }
   };
 
-  function GetThirdIndex(a, from, to) {
-    var t_array = new InternalArray();
-    // Use both 'from' and 'to' to determine the pivot candidates.
-    var increment = 200 + ((to - from) & 15);
-    var j = 0;
-    from += 1;
-    to -= 1;
-    for (var i = from; i < to; i += increment) {
-      t_array[j] = [i, a[i]];
-      j++;
-    }
-    t_array.sort(function(a, b) {
-      return comparefn(a[1], b[1]);
-    });
-    var third_index = t_array[t_array.length >> 1][0];
-    return third_index;
-  }
-
-  function QuickSort(a, from, to) {
-    var third_index = 0;
-    while (true) {
-      // Insertion sort is faster for short arrays.
-      if (to - from <= 10) {
-        InsertionSort(a, from, to);
-        return;
-      }
-      if (to - from > 1000) {
-        third_index = GetThirdIndex(a, from, to);
+  // Merges the sorted runs a[from..middle) and a[middle..to) into the
+  // buffer, and copies the result back once all comparisons are done. The
+  // rest of the upper run is already in place. Equal elements are taken
+  // from the lower run first.
+  function Merge(a, from, middle, to, buffer) {
+    var lower = from;
+    var upper = middle;
+    var length = 0;
+    while (lower < middle && upper < to) {
+      var element = a[upper];
+      var order = comparefn(a[lower], element);
+      if (order > 0) {
+        buffer[length++] = element;
+        upper++;
       } else {
-        third_index = from + ((to - from) >> 1);
+        buffer[length++] = a[lower++];
       }
-      // Find a pivot as the median of first, last and middle element.
-      var v0 = a[from];
-      var v1 = a[to - 1];
-      var v2 = a[third_index];
-      var c01 = comparefn(v0, v1);
-      if (c01 > 0) {
-        // v1 < v0, so swap them.
-        var tmp = v0;
-        v0 = v1;
-        v1 = tmp;
-      } // v0 <= v1.
-      var c02 = comparefn(v0, v2);
-      if (c02 >= 0) {
-        // v2 <= v0 <= v1.
-        var tmp = v0;
-        v0 = v2;
-        v2 = v1;
-        v1 = tmp;
-      } else {
-        // v0 <= v1 && v0 < v2
-        var c12 = comparefn(v1, v2);
-        if (c12 > 0) {
-          // v0 <= v2 < v1
-          var tmp = v1;
-          v1 = v2;
-          v2 = tmp;
-        }
-      }
-      // v0 <= v1 <= v2
-      a[from] = v0;
-      a[to - 1] = v2;
-      var pivot = v1;
-      var low_end = from + 1;   // Upper bound of elements lower than pivot.
-      var high_start = to - 1;  // Lower bound of elements greater than pivot.
-      a[third_index] = a[low_end];
-      a[low_end] = pivot;
-
-      // From low_end to i are elements equal to pivot.
-      // From i to high_start are elements that haven't been compared yet.
-      partition: for (var i = low_end + 1; i < high_start; i++) {
-        var element = a[i];
-        var order = comparefn(element, pivot);
-        if (order < 0) {
-          a[i] = a[low_end];
-          a[low_end] = element;
-          low_end++;
-        } else if (order > 0) {
-          do {
-            high_start--;
-            if (high_start == i) break partition;
-            var top_elem = a[high_start];
-            order = comparefn(top_elem, pivot);
-          } while (order > 0);
-          a[i] = a[high_start];
-          a[high_start] = element;
-          if (order < 0) {
-            element = a[i];
-            a[i] = a[low_end];
-            a[low_end] = element;
-            low_end++;
-          }
+    }
+    while (lower < middle) {
+      buffer[length++] = a[lower++];
+    }
+    for (var i = 0; i < length; i++) {
+      a[from + i] = buffer[i];
+    }
+  };
+
+  function MergeSort(a, from, to) {
+    // Insertion sort is faster for short runs.
+    var run_length = 10;
+    for (var i = from; i < to; i += run_length) {
+      InsertionSort(a, i, MathMin(i + run_length, to));
+    }
+    var buffer = new InternalArray();
+    for (var width = run_length; width < to - from; width *= 2) {
+      for (var low = from; low < to - width; low += 2 * width) {
+        var middle = low + width;
+        // Adjacent runs that are already in order need no merging, which
+        // makes sorting presorted input linear.
+        var order = comparefn(a[middle - 1], a[middle]);
+        if (order > 0) {
+          Merge(a, low, middle, MathMin(middle + width, to), buffer);
         }
       }
-      if (to - high_start < low_end - from) {
-        QuickSort(a, high_start, to);
-        to = low_end;
-      } else {
-        QuickSort(a, from, low_end);
-        from = high_start;
-      }
     }
   };
 
@@ -940,7 +894,10 @@ function InnerArraySort(array, length, comparefn) {
     num_non_undefined = SafeRemoveArrayHoles(array);
   }
 
-  QuickSort(array, 0, num_non_undefined);
+  if (!use_default_comparefn ||
+      !%TrySortSimpleElements(array, num_non_undefined)) {
+    MergeSort(array, 0, num_non_undefined);
+  }
 
   if (!is_array && (num_non_undefined + 1 < max_prototype_element)) {
     // For compatibility with JSC, we shadow any elements in the prototype
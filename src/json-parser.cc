@@ -9,10 +9,11 @@
 #include "src/debug/debug.h"
 #include "src/factory.h"
 #include "src/field-type.h"
+#include "src/global-handles.h"
 #include "src/messages.h"
 #include "src/objects-inl.h"
 #include "src/property-descriptor.h"
-#include "src/string-hasher.h"
+#include "src/string-hasher-inl.h"
 #include "src/transitions.h"
 #include "src/unicode-cache.h"
 #include "src/zone/zone-containers.h"
@@ -135,7 +136,8 @@ bool JsonParseInternalizer::RecurseAndApply(Handle<JSReceiver> holder,
 }
 
 template <bool seq_one_byte>
-JsonParser<seq_one_byte>::JsonParser(Isolate* isolate, Handle<String> source)
+JsonParser<seq_one_byte>::JsonParser(Isolate* isolate, Handle<String> source,
+                                     int position_offset)
     : source_(source),
       source_length_(source->length()),
       isolate_(isolate),
@@ -143,6 +145,7 @@ JsonParser<seq_one_byte>::JsonParser(Isolate* isolate, Handle<String> source)
       object_constructor_(isolate_->native_context()->object_function(),
                           isolate_),
       position_(-1),
+      position_offset_(position_offset),
       properties_(&zone_) {
   source_ = String::Flatten(source_);
   pretenure_ = (source_length_ >= kPretenureTreshold) ? TENURED : NOT_TENURED;
@@ -153,6 +156,13 @@ JsonParser<seq_one_byte>::JsonParser(Isolate* isolate, Handle<String> source)
   }
 }
 
+template <bool seq_one_byte>
+JsonParser<seq_one_byte>::~JsonParser() {
+  if (!transition_cache_.is_null()) {
+    GlobalHandles::Destroy(Handle<Object>::cast(transition_cache_).location());
+  }
+}
+
 template <bool seq_one_byte>
 MaybeHandle<Object> JsonParser<seq_one_byte>::ParseJson() {
   // Advance to the first character (possibly EOS)
@@ -165,7 +175,8 @@ MaybeHandle<Object> JsonParser<seq_one_byte>::ParseJson() {
     // Parse failed. Current character is the unexpected token.
     Factory* factory = this->factory();
     MessageTemplate::Template message;
-    Handle<Object> arg1 = Handle<Smi>(Smi::FromInt(position_), isolate());
+    Handle<Object> arg1 =
+        Handle<Smi>(Smi::FromInt(position_ + position_offset_), isolate());
     Handle<Object> arg2;
 
     switch (c0_) {
@@ -263,13 +274,9 @@ bool JsonParser<seq_one_byte>::ParseJsonString(Handle<String> expected) {
       DCHECK_EQ('"', c0_);
       const uint8_t* input_chars = seq_source_->GetChars() + position_ + 1;
       const uint8_t* expected_chars = content.ToOneByteVector().start();
-      for (int i = 0; i < length; i++) {
-        uint8_t c0 = input_chars[i];
-        if (c0 != expected_chars[i] || c0 == '"' || c0 < 0x20 || c0 == '\\') {
-          return false;
-        }
-      }
-      if (input_chars[length] == '"') {
+      if (JsonStringVerbatimPrefix(input_chars, length) == length &&
+          CompareChars(input_chars, expected_chars, length) == 0 &&
+          input_chars[length] == '"') {
         position_ = position_ + length + 1;
         AdvanceSkipWhitespace();
         return true;
@@ -404,13 +411,20 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
       bool follow_expected = false;
       Handle<Map> target;
       if (seq_one_byte) {
-        DisallowHeapAllocation no_gc;
-        TransitionsAccessor transitions(*map, &no_gc);
-        key = transitions.ExpectedTransitionKey();
-        follow_expected = !key.is_null() && ParseJsonString(key);
-        // If the expected transition hits, follow it.
-        if (follow_expected) {
-          target = transitions.ExpectedTransitionTarget();
+        {
+          DisallowHeapAllocation no_gc;
+          TransitionsAccessor transitions(*map, &no_gc);
+          key = transitions.ExpectedTransitionKey();
+          follow_expected = !key.is_null() && ParseJsonString(key);
+          // If the expected transition hits, follow it.
+          if (follow_expected) {
+            target = transitions.ExpectedTransitionTarget();
+          }
+        }
+        // Otherwise try the transition this parse last followed from the map,
+        // which catches repeated shapes whose maps have several transitions.
+        if (!follow_expected && LookupCachedTransition(map, &key, &target)) {
+          follow_expected = ParseJsonString(key);
         }
       }
       if (!follow_expected) {
@@ -423,6 +437,7 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
         transitioning =
             TransitionsAccessor(map).FindTransitionToField(key).ToHandle(
                 &target);
+        if (seq_one_byte && transitioning) CacheTransition(map, key, target);
       }
       if (c0_ != ':') return ReportUnexpectedCharacter();
 
@@ -513,6 +528,54 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
   return scope.CloseAndEscape(json_object);
 }
 
+template <bool seq_one_byte>
+int JsonParser<seq_one_byte>::TransitionCacheIndex(Map* map) {
+  // A map moved by the GC simply misses in the cache.
+  uintptr_t hash = reinterpret_cast<uintptr_t>(map) >> kPointerSizeLog2;
+  return static_cast<int>(hash & (kTransitionCacheSize - 1)) *
+         kTransitionCacheEntrySize;
+}
+
+template <bool seq_one_byte>
+void JsonParser<seq_one_byte>::CacheTransition(Handle<Map> map,
+                                               Handle<String> key,
+                                               Handle<Map> target) {
+  // Allocated on the first transition, so that parses without object
+  // literals don't pay for it. Nested objects are parsed in handle scopes of
+  // their own, which a global handle doesn't depend on.
+  if (transition_cache_.is_null()) {
+    transition_cache_ = Handle<FixedArray>::cast(
+        isolate_->global_handles()->Create(*factory()->NewFixedArray(
+            kTransitionCacheSize * kTransitionCacheEntrySize)));
+  }
+  DisallowHeapAllocation no_gc;
+  FixedArray* cache = *transition_cache_;
+  int index = TransitionCacheIndex(*map);
+  cache->set(index + kTransitionCacheMapOffset, *map);
+  cache->set(index + kTransitionCacheKeyOffset, *key);
+  cache->set(index + kTransitionCacheTargetOffset, *target);
+}
+
+template <bool seq_one_byte>
+bool JsonParser<seq_one_byte>::LookupCachedTransition(Handle<Map> map,
+                                                      Handle<String>* key,
+                                                      Handle<Map>* target) {
+  if (transition_cache_.is_null()) return false;
+  DisallowHeapAllocation no_gc;
+  FixedArray* cache = *transition_cache_;
+  int index = TransitionCacheIndex(*map);
+  if (cache->get(index + kTransitionCacheMapOffset) != *map) return false;
+  // The cache keeps the target alive, so the transition to it still exists
+  // unless the target was deprecated in the meantime.
+  Map* cached_target =
+      Map::cast(cache->get(index + kTransitionCacheTargetOffset));
+  if (cached_target->is_deprecated()) return false;
+  *key = handle(String::cast(cache->get(index + kTransitionCacheKeyOffset)),
+                isolate());
+  *target = handle(cached_target, isolate());
+  return true;
+}
+
 template <bool seq_one_byte>
 void JsonParser<seq_one_byte>::CommitStateToJsonObject(
     Handle<JSObject> json_object, Handle<Map> map,
@@ -826,61 +889,38 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
     // parsed is not a known internalized string, contains backslashes or
     // unexpectedly reaches the end of string, return with an empty handle.
 
-    // We intentionally use local variables instead of fields, compute hash
-    // while we are iterating a string and manually inline StringTable lookup
-    // here.
-
-    int position = position_;
-    uc32 c0 = c0_;
-    uint32_t running_hash = isolate()->heap()->HashSeed();
-    uint32_t index = 0;
-    bool is_array_index = true;
-
-    do {
-      if (c0 == '\\') {
-        c0_ = c0;
-        int beg_pos = position_;
-        position_ = position;
-        return SlowScanJsonString<SeqOneByteString, uint8_t>(source_, beg_pos,
-                                                             position_);
-      }
-      if (c0 < 0x20) {
-        c0_ = c0;
-        position_ = position;
-        return Handle<String>::null();
-      }
-      if (is_array_index) {
-        // With leading zero, the string has to be "0" to be a valid index.
-        if (!IsDecimalDigit(c0) || (position > position_ && index == 0)) {
-          is_array_index = false;
-        } else {
-          int d = c0 - '0';
-          is_array_index = index <= 429496729U - ((d + 3) >> 3);
-          index = (index * 10) + d;
-        }
-      }
-      running_hash = StringHasher::AddCharacterCore(running_hash,
-                                                    static_cast<uint16_t>(c0));
-      position++;
-      if (position >= source_length_) {
-        c0_ = kEndOfString;
-        position_ = position;
-        return Handle<String>::null();
-      }
-      c0 = seq_source_->SeqOneByteStringGet(position);
-    } while (c0 != '"');
-    int length = position - position_;
-    uint32_t hash;
-    if (is_array_index) {
-      hash =
-          StringHasher::MakeArrayIndexHash(index, length) >> String::kHashShift;
-    } else if (length <= String::kMaxHashCalcLength) {
-      hash = StringHasher::GetHashCore(running_hash);
-    } else {
-      hash = static_cast<uint32_t>(length);
+    // Find the end of the string a word at a time first, then hash it in one
+    // go and manually inline the StringTable lookup here.
+
+    const uint8_t* chars = seq_source_->GetChars();
+    int position =
+        position_ + JsonStringVerbatimPrefix(chars + position_,
+                                             source_length_ - position_);
+    if (position >= source_length_) {
+      c0_ = kEndOfString;
+      position_ = position;
+      return Handle<String>::null();
+    }
+    uc32 c0 = chars[position];
+    if (c0 == '\\') {
+      c0_ = c0;
+      int beg_pos = position_;
+      position_ = position;
+      return SlowScanJsonString<SeqOneByteString, uint8_t>(source_, beg_pos,
+                                                           position_);
+    }
+    if (c0 < 0x20) {
+      c0_ = c0;
+      position_ = position;
+      return Handle<String>::null();
     }
-    Vector<const uint8_t> string_vector(seq_source_->GetChars() + position_,
-                                        length);
+    DCHECK_EQ('"', c0);
+    int length = position - position_;
+    uint32_t hash =
+        StringHasher::HashSequentialString(chars + position_, length,
+                                           isolate()->heap()->HashSeed()) >>
+        String::kHashShift;
+    Vector<const uint8_t> string_vector(chars + position_, length);
     StringTable* string_table = isolate()->heap()->string_table();
     uint32_t capacity = string_table->Capacity();
     uint32_t entry = StringTable::FirstProbe(hash, capacity);
@@ -938,6 +978,228 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
   return result;
 }
 
+namespace {
+
+bool IsJsonWhitespace(uc16 c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+}  // namespace
+
+bool JsonStreamingParser::Feed(const uint8_t* data, size_t length) {
+  size_t i = 0;
+  while (i < length) {
+    bool ok;
+    if (data[i] < 0x80 && utf8_state_ == unibrow::Utf8::State::kAccept) {
+      // ASCII characters need no decoding.
+      ok = AddCharacter(data[i++]);
+    } else {
+      unibrow::uchar c = unibrow::Utf8::ValueOfIncremental(
+          data[i], &i, &utf8_state_, &utf8_incomplete_);
+      ok = c == unibrow::Utf8::kIncomplete || AddCodePoint(c);
+    }
+    if (!ok) {
+      Reset();
+      return false;
+    }
+  }
+  return true;
+}
+
+MaybeHandle<Object> JsonStreamingParser::Finish() {
+  // An incomplete sequence at the end is replaced like an invalid one.
+  unibrow::uchar c = unibrow::Utf8::ValueOfIncrementalFinish(&utf8_state_);
+  if (c != unibrow::Utf8::kBufferEmpty && !AddCodePoint(c)) {
+    Reset();
+    return MaybeHandle<Object>();
+  }
+  MaybeHandle<Object> result;
+  switch (mode_) {
+    case Mode::kValue:
+      result = ParseBuffer(0, static_cast<int>(buffer_.size()));
+      break;
+    case Mode::kDone:
+      result = handle(*result_, isolate_);
+      break;
+    case Mode::kStart:
+    case Mode::kArray:
+    case Mode::kObject:
+      Reset();
+      THROW_NEW_ERROR(isolate_,
+                      NewSyntaxError(MessageTemplate::kJsonParseUnexpectedEOS),
+                      Object);
+  }
+  Reset();
+  return result;
+}
+
+bool JsonStreamingParser::AddCodePoint(unibrow::uchar c) {
+  if (c <= unibrow::Utf16::kMaxNonSurrogateCharCode) {
+    return AddCharacter(static_cast<uc16>(c));
+  }
+  return AddCharacter(unibrow::Utf16::LeadSurrogate(c)) &&
+         AddCharacter(unibrow::Utf16::TrailSurrogate(c));
+}
+
+bool JsonStreamingParser::AddCharacter(uc16 c) {
+  int position = position_++;
+  switch (mode_) {
+    case Mode::kStart:
+      if (IsJsonWhitespace(c)) return true;
+      if (c == '[' || c == '{') {
+        Handle<JSObject> container;
+        if (c == '[') {
+          mode_ = Mode::kArray;
+          container =
+              isolate_->factory()->NewJSArray(PACKED_SMI_ELEMENTS, 0, 0);
+        } else {
+          mode_ = Mode::kObject;
+          container = isolate_->factory()->NewJSObject(
+              handle(isolate_->native_context()->object_function(), isolate_));
+        }
+        result_ = Handle<JSObject>::cast(
+            isolate_->global_handles()->Create(*container));
+        buffer_position_ = position_;
+        return true;
+      }
+      mode_ = Mode::kValue;
+      buffer_position_ = position;
+      buffer_.push_back(c);
+      return true;
+    case Mode::kValue:
+      buffer_.push_back(c);
+      return true;
+    case Mode::kDone:
+      if (IsJsonWhitespace(c)) return true;
+      return ReportUnexpectedCharacter(c, position);
+    case Mode::kArray:
+    case Mode::kObject:
+      break;
+  }
+
+  // Only delimiters outside of the nested values and strings of the current
+  // member end it. JsonParser checks the member itself.
+  if (in_string_) {
+    if (escaped_) {
+      escaped_ = false;
+    } else if (c == '\\') {
+      escaped_ = true;
+    } else if (c == '"') {
+      in_string_ = false;
+    }
+  } else if (c == '"') {
+    in_string_ = true;
+  } else if (c == '[' || c == '{') {
+    depth_++;
+  } else if (depth_ > 0) {
+    if (c == ']' || c == '}') depth_--;
+  } else if (c == ',') {
+    return AddMember(c, position);
+  } else if (c == (mode_ == Mode::kArray ? ']' : '}')) {
+    if (!AddMember(c, position)) return false;
+    mode_ = Mode::kDone;
+    return true;
+  } else if (c == ']' || c == '}') {
+    return ReportUnexpectedCharacter(c, position);
+  } else if (c == ':' && mode_ == Mode::kObject && colon_ < 0) {
+    colon_ = static_cast<int>(buffer_.size());
+  }
+  buffer_.push_back(c);
+  return true;
+}
+
+bool JsonStreamingParser::AddMember(uc16 c, int position) {
+  HandleScope scope(isolate_);
+  int begin = 0;
+  int end = static_cast<int>(buffer_.size());
+  while (begin < end && IsJsonWhitespace(buffer_[begin])) begin++;
+  while (begin < end && IsJsonWhitespace(buffer_[end - 1])) end--;
+  if (begin == end) {
+    // Only an empty array or object has an empty member.
+    if (c == ',' || members_ > 0) return ReportUnexpectedCharacter(c, position);
+    return true;
+  }
+
+  if (mode_ == Mode::kArray) {
+    Handle<Object> value;
+    if (!ParseBuffer(begin, end).ToHandle(&value)) return false;
+    if (JSObject::AddDataElement(result_, members_, value, NONE).is_null()) {
+      return false;
+    }
+  } else {
+    DCHECK_EQ(Mode::kObject, mode_);
+    if (colon_ < 0) return ReportUnexpectedCharacter(c, position);
+    int key_end = colon_;
+    while (key_end > begin && IsJsonWhitespace(buffer_[key_end - 1])) key_end--;
+    if (key_end == begin) {
+      return ReportUnexpectedCharacter(':', buffer_position_ + colon_);
+    }
+    if (colon_ + 1 == end) return ReportUnexpectedCharacter(c, position);
+    Handle<Object> key;
+    if (!ParseBuffer(begin, key_end).ToHandle(&key)) return false;
+    if (!key->IsString()) {
+      return ReportUnexpectedCharacter(buffer_[begin],
+                                       buffer_position_ + begin);
+    }
+    Handle<Object> value;
+    if (!ParseBuffer(colon_ + 1, end).ToHandle(&value)) return false;
+    Handle<String> name =
+        isolate_->factory()->InternalizeString(Handle<String>::cast(key));
+    if (JSObject::DefinePropertyOrElementIgnoreAttributes(result_, name, value)
+            .is_null()) {
+      return false;
+    }
+  }
+  members_++;
+  buffer_.clear();
+  buffer_position_ = position_;
+  colon_ = -1;
+  return true;
+}
+
+MaybeHandle<Object> JsonStreamingParser::ParseBuffer(int begin, int end) {
+  Handle<String> source;
+  if (!isolate_->factory()
+           ->NewStringFromTwoByte(
+               Vector<const uc16>(buffer_.data() + begin, end - begin))
+           .ToHandle(&source)) {
+    return MaybeHandle<Object>();
+  }
+  PostponeInterruptsScope no_debug_breaks(isolate_, StackGuard::DEBUGBREAK);
+  int position = buffer_position_ + begin;
+  return source->IsSeqOneByteString()
+             ? JsonParser<true>(isolate_, source, position).ParseJson()
+             : JsonParser<false>(isolate_, source, position).ParseJson();
+}
+
+bool JsonStreamingParser::ReportUnexpectedCharacter(uc16 c, int position) {
+  Factory* factory = isolate_->factory();
+  Handle<Object> error = factory->NewSyntaxError(
+      MessageTemplate::kJsonParseUnexpectedToken,
+      factory->LookupSingleCharacterStringFromCode(c),
+      handle(Smi::FromInt(position), isolate_));
+  isolate_->Throw(*error);
+  return false;
+}
+
+void JsonStreamingParser::Reset() {
+  utf8_state_ = unibrow::Utf8::State::kAccept;
+  utf8_incomplete_ = 0;
+  mode_ = Mode::kStart;
+  position_ = 0;
+  std::vector<uc16>().swap(buffer_);
+  buffer_position_ = 0;
+  colon_ = -1;
+  depth_ = 0;
+  in_string_ = false;
+  escaped_ = false;
+  if (!result_.is_null()) {
+    GlobalHandles::Destroy(reinterpret_cast<Object**>(result_.location()));
+    result_ = Handle<JSObject>();
+  }
+  members_ = 0;
+}
+
 // Explicit instantiation.
 template class JsonParser<true>;
 template class JsonParser<false>;
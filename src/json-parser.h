@@ -8,6 +8,7 @@
 #include "src/factory.h"
 #include "src/isolate.h"
 #include "src/objects.h"
+#include "src/unicode.h"
 #include "src/zone/zone-containers.h"
 
 namespace v8 {
@@ -54,7 +55,12 @@ class JsonParser BASE_EMBEDDED {
   static const int kEndOfString = -1;
 
  private:
-  JsonParser(Isolate* isolate, Handle<String> source);
+  friend class JsonStreamingParser;
+
+  // The source may be a part of a larger text that starts at
+  // |position_offset|, which error messages then report positions in.
+  JsonParser(Isolate* isolate, Handle<String> source, int position_offset = 0);
+  ~JsonParser();
 
   // Parse a string containing a single JSON value.
   MaybeHandle<Object> ParseJson();
@@ -144,6 +150,21 @@ class JsonParser BASE_EMBEDDED {
   void CommitStateToJsonObject(Handle<JSObject> json_object, Handle<Map> map,
                                Vector<const Handle<Object>> properties);
 
+  // A small per-parse cache of the transition ParseJsonObject last followed
+  // from a map. Objects of a repeated shape then match each key against the
+  // cached one instead of internalizing it and searching the transitions.
+  static int TransitionCacheIndex(Map* map);
+  void CacheTransition(Handle<Map> map, Handle<String> key,
+                       Handle<Map> target);
+  bool LookupCachedTransition(Handle<Map> map, Handle<String>* key,
+                              Handle<Map>* target);
+
+  static const int kTransitionCacheSize = 16;
+  static const int kTransitionCacheMapOffset = 0;
+  static const int kTransitionCacheKeyOffset = 1;
+  static const int kTransitionCacheTargetOffset = 2;
+  static const int kTransitionCacheEntrySize = 3;
+
   Handle<String> source_;
   int source_length_;
   Handle<SeqOneByteString> seq_source_;
@@ -154,9 +175,67 @@ class JsonParser BASE_EMBEDDED {
   Handle<JSFunction> object_constructor_;
   uc32 c0_;
   int position_;
+  int position_offset_;
 
   // Property handles are stored here inside ParseJsonObject.
   ZoneVector<Handle<Object>> properties_;
+
+  // Entries of (map, key, target) for the seq_one_byte case, see
+  // CacheTransition. A global handle, or null until the first transition is
+  // cached.
+  Handle<FixedArray> transition_cache_;
+};
+
+// Parses JSON text that arrives as UTF-8 in chunks, e.g. from the network.
+// The elements of a top-level array and the properties of a top-level object
+// are each parsed by JsonParser as soon as the chunks complete them, so only
+// the text of the member that is still incomplete is kept. Any other
+// top-level value is kept and parsed once the text is complete.
+class JsonStreamingParser {
+ public:
+  explicit JsonStreamingParser(Isolate* isolate) : isolate_(isolate) {}
+  ~JsonStreamingParser() { Reset(); }
+
+  // Parses the next |length| bytes of the text. Returns false if the text
+  // is not valid JSON so far. The SyntaxError is then pending and the parser
+  // starts over with the next call.
+  MUST_USE_RESULT bool Feed(const uint8_t* data, size_t length);
+
+  // Returns the value of the text fed so far, which has to be complete, and
+  // starts over for new text.
+  MUST_USE_RESULT MaybeHandle<Object> Finish();
+
+ private:
+  enum class Mode { kStart, kArray, kObject, kValue, kDone };
+
+  bool AddCodePoint(unibrow::uchar c);
+  bool AddCharacter(uc16 c);
+  // Parses the buffered member that the delimiter |c| at |position| ends.
+  bool AddMember(uc16 c, int position);
+  MaybeHandle<Object> ParseBuffer(int begin, int end);
+  bool ReportUnexpectedCharacter(uc16 c, int position);
+  void Reset();
+
+  Isolate* isolate_;
+  unibrow::Utf8::State utf8_state_ = unibrow::Utf8::State::kAccept;
+  unibrow::Utf8::Utf8IncrementalBuffer utf8_incomplete_ = 0;
+  Mode mode_ = Mode::kStart;
+  // Position of the next character in the whole text.
+  int position_ = 0;
+  // The text of the current member or of the whole top-level value, and its
+  // position in the whole text.
+  std::vector<uc16> buffer_;
+  int buffer_position_ = 0;
+  // Position of the ':' of the current property in buffer_, or -1.
+  int colon_ = -1;
+  // Nesting of the current member and the state of its strings.
+  int depth_ = 0;
+  bool in_string_ = false;
+  bool escaped_ = false;
+  // Global handle to the top-level array or object, and the number of
+  // members added to it.
+  Handle<JSObject> result_;
+  uint32_t members_ = 0;
 };
 
 }  // namespace internal
@@ -5,6 +5,7 @@
 #include "src/json-stringifier.h"
 
 #include "src/conversions.h"
+#include "src/global-handles.h"
 #include "src/lookup.h"
 #include "src/messages.h"
 #include "src/objects-inl.h"
@@ -87,6 +88,13 @@ JsonStringifier::JsonStringifier(Isolate* isolate)
   stack_ = factory()->NewJSArray(8);
 }
 
+JsonStringifier::~JsonStringifier() {
+  DeleteArray(gap_);
+  if (!key_cache_.is_null()) {
+    GlobalHandles::Destroy(Handle<Object>::cast(key_cache_).location());
+  }
+}
+
 MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
                                                Handle<Object> replacer,
                                                Handle<Object> gap) {
@@ -276,7 +284,8 @@ void JsonStringifier::StackPop() {
 template <bool deferred_string_key>
 JsonStringifier::Result JsonStringifier::Serialize_(Handle<Object> object,
                                                     bool comma,
-                                                    Handle<Object> key) {
+                                                    Handle<Object> key,
+                                                    int fragment) {
   StackLimitCheck interrupt_check(isolate_);
   Handle<Object> initial_value = object;
   if (interrupt_check.InterruptRequested() &&
@@ -294,14 +303,14 @@ JsonStringifier::Result JsonStringifier::Serialize_(Handle<Object> object,
   }
 
   if (object->IsSmi()) {
-    if (deferred_string_key) SerializeDeferredKey(comma, key);
+    if (deferred_string_key) SerializeDeferredKey(comma, key, fragment);
     return SerializeSmi(Smi::cast(*object));
   }
 
   switch (HeapObject::cast(*object)->map()->instance_type()) {
     case HEAP_NUMBER_TYPE:
     case MUTABLE_HEAP_NUMBER_TYPE:
-      if (deferred_string_key) SerializeDeferredKey(comma, key);
+      if (deferred_string_key) SerializeDeferredKey(comma, key, fragment);
       return SerializeHeapNumber(Handle<HeapNumber>::cast(object));
     case BIGINT_TYPE:
       isolate_->Throw(
@@ -310,38 +319,38 @@ JsonStringifier::Result JsonStringifier::Serialize_(Handle<Object> object,
     case ODDBALL_TYPE:
       switch (Oddball::cast(*object)->kind()) {
         case Oddball::kFalse:
-          if (deferred_string_key) SerializeDeferredKey(comma, key);
+          if (deferred_string_key) SerializeDeferredKey(comma, key, fragment);
           builder_.AppendCString("false");
           return SUCCESS;
         case Oddball::kTrue:
-          if (deferred_string_key) SerializeDeferredKey(comma, key);
+          if (deferred_string_key) SerializeDeferredKey(comma, key, fragment);
           builder_.AppendCString("true");
           return SUCCESS;
         case Oddball::kNull:
-          if (deferred_string_key) SerializeDeferredKey(comma, key);
+          if (deferred_string_key) SerializeDeferredKey(comma, key, fragment);
           builder_.AppendCString("null");
           return SUCCESS;
         default:
           return UNCHANGED;
       }
     case JS_ARRAY_TYPE:
-      if (deferred_string_key) SerializeDeferredKey(comma, key);
+      if (deferred_string_key) SerializeDeferredKey(comma, key, fragment);
       return SerializeJSArray(Handle<JSArray>::cast(object));
     case JS_VALUE_TYPE:
-      if (deferred_string_key) SerializeDeferredKey(comma, key);
+      if (deferred_string_key) SerializeDeferredKey(comma, key, fragment);
       return SerializeJSValue(Handle<JSValue>::cast(object));
     case SYMBOL_TYPE:
       return UNCHANGED;
     default:
       if (object->IsString()) {
-        if (deferred_string_key) SerializeDeferredKey(comma, key);
+        if (deferred_string_key) SerializeDeferredKey(comma, key, fragment);
         SerializeString(Handle<String>::cast(object));
         return SUCCESS;
       } else {
         DCHECK(object->IsJSReceiver());
         if (object->IsCallable()) return UNCHANGED;
         // Go to slow path for global proxy and objects requiring access checks.
-        if (deferred_string_key) SerializeDeferredKey(comma, key);
+        if (deferred_string_key) SerializeDeferredKey(comma, key, fragment);
         if (object->IsJSProxy()) {
           return SerializeJSProxy(Handle<JSProxy>::cast(object));
         }
@@ -530,6 +539,7 @@ JsonStringifier::Result JsonStringifier::SerializeJSObject(
     DCHECK(!js_obj->HasIndexedInterceptor());
     DCHECK(!js_obj->HasNamedInterceptor());
     Handle<Map> map(js_obj->map());
+    Handle<FixedArray> key_fragments = GetKeyFragments(map);
     builder_.AppendCharacter('{');
     Indent();
     bool comma = false;
@@ -551,7 +561,10 @@ JsonStringifier::Result JsonStringifier::SerializeJSObject(
             isolate_, property, Object::GetPropertyOrElement(js_obj, key),
             EXCEPTION);
       }
-      Result result = SerializeProperty(property, comma, key);
+      int key_fragment = key_fragments.is_null()
+                             ? kNoKeyFragment
+                             : Smi::ToInt(key_fragments->get(i));
+      Result result = SerializeProperty(property, comma, key, key_fragment);
       if (!comma && result == SUCCESS) comma = true;
       if (result == EXCEPTION) return result;
     }
@@ -566,6 +579,69 @@ JsonStringifier::Result JsonStringifier::SerializeJSObject(
   return SUCCESS;
 }
 
+Handle<FixedArray> JsonStringifier::GetKeyFragments(Handle<Map> map) {
+  // Allocated lazily, since even primitive roots can turn into objects
+  // through the replacer function or toJSON. The cache outlives the handle
+  // scope of the SerializeJSObject call that allocates it, so it is kept in
+  // a global handle.
+  if (key_cache_.is_null()) {
+    key_cache_ = Handle<FixedArray>::cast(isolate_->global_handles()->Create(
+        *factory()->NewFixedArray(kKeyCacheSize * kKeyCacheEntrySize)));
+  }
+  // A map moved by the GC simply misses in the cache.
+  uintptr_t hash = reinterpret_cast<uintptr_t>(*map) >> kPointerSizeLog2;
+  int index =
+      static_cast<int>(hash & (kKeyCacheSize - 1)) * kKeyCacheEntrySize;
+  {
+    DisallowHeapAllocation no_gc;
+    FixedArray* cache = *key_cache_;
+    if (cache->get(index + kKeyCacheMapOffset) == *map) {
+      return handle(
+          FixedArray::cast(cache->get(index + kKeyCacheFragmentsOffset)),
+          isolate_);
+    }
+  }
+  // Fragments of evicted maps stay in key_fragments_, since outer objects
+  // may still be using them.
+  if (key_fragments_.size() >= kMaxKeyFragmentsSize) {
+    return Handle<FixedArray>::null();
+  }
+  int descriptors = map->NumberOfOwnDescriptors();
+  Handle<FixedArray> fragments = factory()->NewFixedArray(descriptors);
+  DisallowHeapAllocation no_gc;
+  for (int i = 0; i < descriptors; i++) {
+    Name* name = map->instance_descriptors()->GetKey(i);
+    int fragment = kNoKeyFragment;
+    if (name->IsString() && String::cast(name)->IsOneByteRepresentation()) {
+      fragment = AddKeyFragment(String::cast(name));
+    }
+    fragments->set(i, Smi::FromInt(fragment));
+  }
+  FixedArray* cache = *key_cache_;
+  cache->set(index + kKeyCacheMapOffset, *map);
+  cache->set(index + kKeyCacheFragmentsOffset, *fragments);
+  return fragments;
+}
+
+int JsonStringifier::AddKeyFragment(String* key) {
+  DisallowHeapAllocation no_gc;
+  int fragment = static_cast<int>(key_fragments_.size());
+  String::FlatContent content = key->GetFlatContent();
+  DCHECK(content.IsOneByte());
+  Vector<const uint8_t> chars = content.ToOneByteVector();
+  key_fragments_.push_back('"');
+  for (int i = 0; i < chars.length(); i++) {
+    const char* escaped =
+        &JsonEscapeTable[chars[i] * kJsonEscapeTableEntrySize];
+    while (*escaped != '\0') key_fragments_.push_back(*(escaped++));
+  }
+  key_fragments_.push_back('"');
+  key_fragments_.push_back(':');
+  if (gap_ != nullptr) key_fragments_.push_back(' ');
+  key_fragments_.push_back('\0');
+  return fragment;
+}
+
 JsonStringifier::Result JsonStringifier::SerializeJSReceiverSlow(
     Handle<JSReceiver> object) {
   Handle<FixedArray> contents = property_list_;
@@ -649,6 +725,24 @@ void JsonStringifier::SerializeStringUnchecked_(
   }
 }
 
+template <>
+void JsonStringifier::SerializeStringUnchecked_(
+    Vector<const uint8_t> src,
+    IncrementalStringBuilder::NoExtend<uint8_t>* dest) {
+  // Copy runs of characters that need no escaping in bulk.
+  const uint8_t* chars = src.start();
+  int length = src.length();
+  int i = 0;
+  while (i < length) {
+    int verbatim_length = JsonStringVerbatimPrefix(chars + i, length - i);
+    dest->AppendChars(chars + i, verbatim_length);
+    i += verbatim_length;
+    if (i == length) break;
+    dest->AppendCString(&JsonEscapeTable[chars[i] * kJsonEscapeTableEntrySize]);
+    i++;
+  }
+}
+
 template <typename SrcChar, typename DestChar>
 void JsonStringifier::SerializeString_(Handle<String> string) {
   int length = string->length();
@@ -697,8 +791,13 @@ void JsonStringifier::Separator(bool first) {
 }
 
 void JsonStringifier::SerializeDeferredKey(bool deferred_comma,
-                                           Handle<Object> deferred_key) {
+                                           Handle<Object> deferred_key,
+                                           int key_fragment) {
   Separator(!deferred_comma);
+  if (key_fragment != kNoKeyFragment) {
+    builder_.AppendCString(&key_fragments_[key_fragment]);
+    return;
+  }
   SerializeString(Handle<String>::cast(deferred_key));
   builder_.AppendCharacter(':');
   if (gap_ != nullptr) builder_.AppendCharacter(' ');
@@ -5,6 +5,8 @@
 #ifndef V8_JSON_STRINGIFIER_H_
 #define V8_JSON_STRINGIFIER_H_
 
+#include <vector>
+
 #include "src/objects.h"
 #include "src/string-builder.h"
 
@@ -15,7 +17,7 @@ class JsonStringifier BASE_EMBEDDED {
  public:
   explicit JsonStringifier(Isolate* isolate);
 
-  ~JsonStringifier() { DeleteArray(gap_); }
+  ~JsonStringifier();
 
   MUST_USE_RESULT MaybeHandle<Object> Stringify(Handle<Object> object,
                                                 Handle<Object> replacer,
@@ -51,18 +53,31 @@ class JsonStringifier BASE_EMBEDDED {
   // Serialize a object property.
   // The key may or may not be serialized depending on the property.
   // The key may also serve as argument for the toJSON function.
+  // If given, the key fragment is the key as already serialized, see
+  // GetKeyFragments.
   INLINE(Result SerializeProperty(Handle<Object> object,
                                   bool deferred_comma,
-                                  Handle<String> deferred_key)) {
+                                  Handle<String> deferred_key,
+                                  int key_fragment = kNoKeyFragment)) {
     DCHECK(!deferred_key.is_null());
-    return Serialize_<true>(object, deferred_comma, deferred_key);
+    return Serialize_<true>(object, deferred_comma, deferred_key,
+                            key_fragment);
   }
 
   template <bool deferred_string_key>
-  Result Serialize_(Handle<Object> object, bool comma, Handle<Object> key);
+  Result Serialize_(Handle<Object> object, bool comma, Handle<Object> key,
+                    int fragment = kNoKeyFragment);
 
   INLINE(void SerializeDeferredKey(bool deferred_comma,
-                                   Handle<Object> deferred_key));
+                                   Handle<Object> deferred_key,
+                                   int key_fragment));
+
+  // Returns the serialized keys of the own descriptors of |map|, as offsets
+  // into key_fragments_ or kNoKeyFragment. The result is cached per map for
+  // the duration of the call, so objects of the same shape escape their keys
+  // only once. Returns a null handle if the cache is full.
+  Handle<FixedArray> GetKeyFragments(Handle<Map> map);
+  int AddKeyFragment(String* key);
 
   Result SerializeSmi(Smi* object);
 
@@ -116,6 +131,18 @@ class JsonStringifier BASE_EMBEDDED {
   uc16* gap_;
   int indent_;
 
+  // Entries of (map, key fragments), see GetKeyFragments. A global handle,
+  // which is null until the first object is serialized.
+  Handle<FixedArray> key_cache_;
+  std::vector<char> key_fragments_;
+
+  static const int kKeyCacheSize = 8;
+  static const int kKeyCacheMapOffset = 0;
+  static const int kKeyCacheFragmentsOffset = 1;
+  static const int kKeyCacheEntrySize = 2;
+  static const int kNoKeyFragment = -1;
+  static const size_t kMaxKeyFragmentsSize = 64 * KB;
+
   static const int kJsonEscapeTableEntrySize = 8;
   static const char* const JsonEscapeTable;
 };
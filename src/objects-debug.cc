@@ -1305,16 +1305,33 @@ void JSRegExp::JSRegExpVerify() {
       FixedArray* arr = FixedArray::cast(data());
       Object* one_byte_data = arr->get(JSRegExp::kIrregexpLatin1CodeIndex);
       // Smi : Not compiled yet (-1).
-      // Code/ByteArray: Compiled code.
-      CHECK(
-          (one_byte_data->IsSmi() &&
-           Smi::ToInt(one_byte_data) == JSRegExp::kUninitializedValue) ||
-          (is_native ? one_byte_data->IsCode() : one_byte_data->IsByteArray()));
+      // ByteArray: Compiled bytecode.
+      // Code: Compiled native code, after tier-up.
+      CHECK((one_byte_data->IsSmi() &&
+             Smi::ToInt(one_byte_data) == JSRegExp::kUninitializedValue) ||
+            one_byte_data->IsByteArray() ||
+            (is_native && one_byte_data->IsCode()));
       Object* uc16_data = arr->get(JSRegExp::kIrregexpUC16CodeIndex);
       CHECK((uc16_data->IsSmi() &&
              Smi::ToInt(uc16_data) == JSRegExp::kUninitializedValue) ||
-            (is_native ? uc16_data->IsCode() : uc16_data->IsByteArray()));
+            uc16_data->IsByteArray() || (is_native && uc16_data->IsCode()));
 
+      CHECK(arr->get(JSRegExp::kIrregexpCaptureCountIndex)->IsSmi());
+      CHECK(arr->get(JSRegExp::kIrregexpMaxRegisterCountIndex)->IsSmi());
+      CHECK(arr->get(JSRegExp::kIrregexpTicksUntilTierUpIndex)->IsSmi());
+      Object* literal = arr->get(JSRegExp::kIrregexpRequiredLiteralIndex);
+      CHECK(literal == Smi::kZero || literal->IsSeqString());
+      CHECK(
+          arr->get(JSRegExp::kIrregexpRequiredLiteralMinOffsetIndex)->IsSmi());
+      CHECK(
+          arr->get(JSRegExp::kIrregexpRequiredLiteralMaxOffsetIndex)->IsSmi());
+      break;
+    }
+    case JSRegExp::LINEAR: {
+      FixedArray* arr = FixedArray::cast(data());
+      Object* program = arr->get(JSRegExp::kIrregexpLatin1CodeIndex);
+      CHECK(program->IsByteArray());
+      CHECK_EQ(program, arr->get(JSRegExp::kIrregexpUC16CodeIndex));
       CHECK(arr->get(JSRegExp::kIrregexpCaptureCountIndex)->IsSmi());
       CHECK(arr->get(JSRegExp::kIrregexpMaxRegisterCountIndex)->IsSmi());
       break;
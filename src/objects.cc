@@ -2525,6 +2525,77 @@ void Smi::SmiPrint(std::ostream& os) const {  // NOLINT
   os << value();
 }
 
+// static
+int Smi::LexicographicCompare(Smi* x, Smi* y) {
+  int x_value = x->value();
+  int y_value = y->value();
+
+  // If the integers are equal so are the string representations.
+  if (x_value == y_value) return 0;
+
+  // If one of the integers is zero the normal integer order is the
+  // same as the lexicographic order of the string representations.
+  if (x_value == 0 || y_value == 0) return x_value < y_value ? -1 : 1;
+
+  // If only one of the integers is negative the negative number is
+  // smallest because the char code of '-' is less than the char code
+  // of any digit.  Otherwise, we make both values positive.
+
+  // Use unsigned values otherwise the logic is incorrect for -MIN_INT on
+  // architectures using 32-bit Smis.
+  uint32_t x_scaled = x_value;
+  uint32_t y_scaled = y_value;
+  if (x_value < 0 || y_value < 0) {
+    if (y_value >= 0) return -1;
+    if (x_value >= 0) return 1;
+    x_scaled = -x_value;
+    y_scaled = -y_value;
+  }
+
+  static const uint32_t kPowersOf10[] = {
+      1,                 10,                100,         1000,
+      10 * 1000,         100 * 1000,        1000 * 1000, 10 * 1000 * 1000,
+      100 * 1000 * 1000, 1000 * 1000 * 1000};
+
+  // If the integers have the same number of decimal digits they can be
+  // compared directly as the numeric order is the same as the
+  // lexicographic order.  If one integer has fewer digits, it is scaled
+  // by some power of 10 to have the same number of digits as the longer
+  // integer.  If the scaled integers are equal it means the shorter
+  // integer comes first in the lexicographic order.
+
+  // From http://graphics.stanford.edu/~seander/bithacks.html#IntegerLog10
+  int x_log2 = 31 - base::bits::CountLeadingZeros(x_scaled);
+  int x_log10 = ((x_log2 + 1) * 1233) >> 12;
+  x_log10 -= x_scaled < kPowersOf10[x_log10];
+
+  int y_log2 = 31 - base::bits::CountLeadingZeros(y_scaled);
+  int y_log10 = ((y_log2 + 1) * 1233) >> 12;
+  y_log10 -= y_scaled < kPowersOf10[y_log10];
+
+  int tie = 0;
+
+  if (x_log10 < y_log10) {
+    // X has fewer digits.  We would like to simply scale up X but that
+    // might overflow, e.g when comparing 9 with 1_000_000_000, 9 would
+    // be scaled up to 9_000_000_000. So we scale up by the next
+    // smallest power and scale down Y to drop one digit. It is OK to
+    // drop one digit from the longer integer since the final digit is
+    // past the length of the shorter integer.
+    x_scaled *= kPowersOf10[y_log10 - x_log10 - 1];
+    y_scaled /= 10;
+    tie = -1;
+  } else if (y_log10 < x_log10) {
+    y_scaled *= kPowersOf10[x_log10 - y_log10 - 1];
+    x_scaled /= 10;
+    tie = 1;
+  }
+
+  if (x_scaled < y_scaled) return -1;
+  if (x_scaled > y_scaled) return 1;
+  return tie;
+}
+
 Handle<String> String::SlowFlatten(Handle<ConsString> cons,
                                    PretenureFlag pretenure) {
   DCHECK_NE(cons->second()->length(), 0);
@@ -11241,12 +11312,12 @@ Handle<FixedArray> String::CalculateLineEnds(Handle<String> src,
 
 
 // Compares the contents of two strings by reading and comparing
-// int-sized blocks of characters.
-template <typename Char>
-static inline bool CompareRawStringContents(const Char* const a,
-                                            const Char* const b,
+// word-sized blocks of characters.
+template <typename Char1, typename Char2>
+static inline bool CompareRawStringContents(const Char1* const a,
+                                            const Char2* const b,
                                             int length) {
-  return CompareChars(a, b, length) == 0;
+  return CompareCharsEqual(a, b, length);
 }
 
 
@@ -11255,12 +11326,7 @@ class RawStringComparator : public AllStatic {
  public:
   static inline bool compare(const Chars1* a, const Chars2* b, int len) {
     DCHECK(sizeof(Chars1) != sizeof(Chars2));
-    for (int i = 0; i < len; i++) {
-      if (a[i] != b[i]) {
-        return false;
-      }
-    }
-    return true;
+    return CompareRawStringContents(a, b, len);
   }
 };
 
@@ -11489,16 +11555,22 @@ bool String::SlowEquals(Handle<String> one, Handle<String> two) {
   String::FlatContent flat1 = one->GetFlatContent();
   String::FlatContent flat2 = two->GetFlatContent();
 
-  if (flat1.IsOneByte() && flat2.IsOneByte()) {
+  if (flat1.IsOneByte()) {
+    if (flat2.IsOneByte()) {
       return CompareRawStringContents(flat1.ToOneByteVector().start(),
                                       flat2.ToOneByteVector().start(),
                                       one_length);
-  } else {
-    for (int i = 0; i < one_length; i++) {
-      if (flat1.Get(i) != flat2.Get(i)) return false;
     }
-    return true;
+    return CompareRawStringContents(flat1.ToOneByteVector().start(),
+                                    flat2.ToUC16Vector().start(), one_length);
+  }
+  if (flat2.IsOneByte()) {
+    return CompareRawStringContents(flat1.ToUC16Vector().start(),
+                                    flat2.ToOneByteVector().start(),
+                                    one_length);
   }
+  return CompareRawStringContents(flat1.ToUC16Vector().start(),
+                                  flat2.ToUC16Vector().start(), one_length);
 }
 
 
@@ -11943,8 +12015,12 @@ bool String::IsOneByteEqualTo(Vector<const uint8_t> str) {
   DisallowHeapAllocation no_gc;
   FlatContent content = GetFlatContent();
   if (content.IsOneByte()) {
-    return CompareChars(content.ToOneByteVector().start(),
-                        str.start(), slen) == 0;
+    return CompareCharsEqual(content.ToOneByteVector().start(), str.start(),
+                             slen);
+  }
+  if (content.IsTwoByte()) {
+    return CompareCharsEqual(content.ToUC16Vector().start(), str.start(),
+                             slen);
   }
   for (int i = 0; i < slen; i++) {
     if (Get(i) != static_cast<uint16_t>(str[i])) return false;
@@ -11959,7 +12035,11 @@ bool String::IsTwoByteEqualTo(Vector<const uc16> str) {
   DisallowHeapAllocation no_gc;
   FlatContent content = GetFlatContent();
   if (content.IsTwoByte()) {
-    return CompareChars(content.ToUC16Vector().start(), str.start(), slen) == 0;
+    return CompareCharsEqual(content.ToUC16Vector().start(), str.start(), slen);
+  }
+  if (content.IsOneByte()) {
+    return CompareCharsEqual(content.ToOneByteVector().start(), str.start(),
+                             slen);
   }
   for (int i = 0; i < slen; i++) {
     if (Get(i) != str[i]) return false;
@@ -12073,7 +12153,8 @@ uint32_t StringHasher::GetHashField() {
     if (is_array_index_) {
       return MakeArrayIndexHash(array_index_, length_);
     }
-    return (GetHashCore(raw_running_hash_) << String::kHashShift) |
+    return (GetBlockHashCore(raw_running_hash_, pending_block_, length_)
+            << String::kHashShift) |
            String::kIsNotArrayIndexMask;
   } else {
     return (length_ << String::kHashShift) | String::kIsNotArrayIndexMask;
@@ -16945,8 +17026,8 @@ Handle<PropertyCell> JSGlobalObject::EnsureEmptyPropertyCell(
 
 
 // This class is used for looking up two character strings in the string table.
-// If we don't have a hit we don't want to waste much time so we unroll the
-// string hash calculation loop here for speed.  Doesn't work if the two
+// If we don't have a hit we don't want to waste much time so we compute the
+// string hash of the two characters directly here.  Doesn't work if the two
 // characters form a decimal integer, since such strings have a different hash
 // algorithm.
 class TwoCharHashTableKey : public StringTableKey {
@@ -16969,20 +17050,9 @@ class TwoCharHashTableKey : public StringTableKey {
 
  private:
   uint32_t ComputeHashField(uint16_t c1, uint16_t c2, uint32_t seed) {
-    // Char 1.
-    uint32_t hash = seed;
-    hash += c1;
-    hash += hash << 10;
-    hash ^= hash >> 6;
-    // Char 2.
-    hash += c2;
-    hash += hash << 10;
-    hash ^= hash >> 6;
-    // GetHash.
-    hash += hash << 3;
-    hash ^= hash >> 11;
-    hash += hash << 15;
-    if ((hash & String::kHashBitMask) == 0) hash = StringHasher::kZeroHash;
+    // Both characters fit in the last, incomplete block.
+    uint64_t block = c1 | static_cast<uint64_t>(c2) << 16;
+    uint32_t hash = StringHasher::GetBlockHashCore(seed, block, 2);
     hash = (hash << String::kHashShift) | String::kIsNotArrayIndexMask;
 #ifdef DEBUG
     // If this assert fails then we failed to reproduce the two-character
@@ -17256,10 +17326,8 @@ class StringTableNoAllocateKey : public StringTableKey {
             one_byte_content_, flat_content.ToOneByteVector().start(), len);
       } else {
         DCHECK(flat_content.IsTwoByte());
-        for (int i = 0; i < len; i++) {
-          if (flat_content.Get(i) != one_byte_content_[i]) return false;
-        }
-        return true;
+        return CompareRawStringContents(
+            one_byte_content_, flat_content.ToUC16Vector().start(), len);
       }
     } else {
       if (flat_content.IsTwoByte()) {
@@ -17267,10 +17335,8 @@ class StringTableNoAllocateKey : public StringTableKey {
             two_byte_content_, flat_content.ToUC16Vector().start(), len);
       } else {
         DCHECK(flat_content.IsOneByte());
-        for (int i = 0; i < len; i++) {
-          if (flat_content.Get(i) != two_byte_content_[i]) return false;
-        }
-        return true;
+        return CompareRawStringContents(
+            two_byte_content_, flat_content.ToOneByteVector().start(), len);
       }
     }
   }
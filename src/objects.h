@@ -1622,6 +1622,10 @@ class Smi: public Object {
     return result;
   }
 
+  // Compares two Smis as if they were converted to strings and then compared
+  // lexicographically. Returns -1, 0 or 1.
+  static int LexicographicCompare(Smi* x, Smi* y);
+
   DECL_CAST(Smi)
 
   // Dispatched behavior.
@@ -36,6 +36,7 @@ int JSRegExp::CaptureCount() {
     case ATOM:
       return 0;
     case IRREGEXP:
+    case LINEAR:
       return Smi::ToInt(DataAt(kIrregexpCaptureCountIndex));
     default:
       UNREACHABLE();
@@ -58,7 +59,7 @@ String* JSRegExp::Pattern() {
 
 Object* JSRegExp::CaptureNameMap() {
   DCHECK(this->data()->IsFixedArray());
-  DCHECK_EQ(TypeTag(), IRREGEXP);
+  DCHECK(TypeTag() == IRREGEXP || TypeTag() == LINEAR);
   Object* value = DataAt(kIrregexpCaptureNameMapIndex);
   DCHECK_NE(value, Smi::FromInt(JSRegExp::kUninitializedValue));
   return value;
@@ -76,6 +77,27 @@ void JSRegExp::SetDataAt(int index, Object* value) {
   FixedArray::cast(data())->set(index, value);
 }
 
+bool JSRegExp::ShouldProduceBytecode() {
+  DCHECK_EQ(IRREGEXP, TypeTag());
+#ifdef V8_INTERPRETED_REGEXP
+  return true;
+#else
+  return Smi::ToInt(DataAt(kIrregexpTicksUntilTierUpIndex)) > 0;
+#endif  // V8_INTERPRETED_REGEXP
+}
+
+void JSRegExp::TierUpTick() {
+  DCHECK_EQ(IRREGEXP, TypeTag());
+  int ticks = Smi::ToInt(DataAt(kIrregexpTicksUntilTierUpIndex));
+  if (ticks == 0) return;
+  SetDataAt(kIrregexpTicksUntilTierUpIndex, Smi::FromInt(ticks - 1));
+}
+
+void JSRegExp::MarkTierUpForNextExec() {
+  DCHECK_EQ(IRREGEXP, TypeTag());
+  SetDataAt(kIrregexpTicksUntilTierUpIndex, Smi::kZero);
+}
+
 }  // namespace internal
 }  // namespace v8
 
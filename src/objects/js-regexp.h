@@ -17,7 +17,8 @@ namespace internal {
 // The regular expression holds a single reference to a FixedArray in
 // the kDataOffset field.
 // The FixedArray contains the following data:
-// - tag : type of regexp implementation (not compiled yet, atom or irregexp)
+// - tag : type of regexp implementation (not compiled yet, atom, irregexp or
+//   linear)
 // - reference to the original source string
 // - reference to the original flag string
 // If it is an atom regexp
@@ -29,13 +30,16 @@ namespace internal {
 // used for tracking the last usage (used for regexp code flushing).
 // - max number of registers used by irregexp implementations.
 // - number of capture registers (output values) of the regexp.
+// A linear regexp uses the irregexp layout, with the same ByteArray program
+// for the linear-time engine in both code fields.
 class JSRegExp : public JSObject {
  public:
   // Meaning of Type:
   // NOT_COMPILED: Initial value. No data has been stored in the JSRegExp yet.
   // ATOM: A simple string to match against using an indexOf operation.
   // IRREGEXP: Compiled with Irregexp.
-  enum Type { NOT_COMPILED, ATOM, IRREGEXP };
+  // LINEAR: Compiled for the linear-time engine (see regexp-linear.h).
+  enum Type { NOT_COMPILED, ATOM, IRREGEXP, LINEAR };
   enum Flag {
     kNone = 0,
     kGlobal = 1 << 0,
@@ -75,6 +79,13 @@ class JSRegExp : public JSObject {
   // Set implementation data after the object has been prepared.
   inline void SetDataAt(int index, Object* value);
 
+  // Irregexp regexps are first compiled to bytecode and run by the
+  // interpreter. After kIrregexpTicksUntilTierUpIndex executions they are
+  // recompiled to native code.
+  inline bool ShouldProduceBytecode();
+  inline void TierUpTick();
+  inline void MarkTierUpForNextExec();
+
   static int code_index(bool is_latin1) {
     if (is_latin1) {
       return kIrregexpLatin1CodeIndex;
@@ -123,8 +134,20 @@ class JSRegExp : public JSObject {
   // Maps names of named capture groups (at indices 2i) to their corresponding
   // (1-based) capture group indices (at indices 2i + 1).
   static const int kIrregexpCaptureNameMapIndex = kDataIndex + 4;
-
-  static const int kIrregexpDataSize = kIrregexpCaptureNameMapIndex + 1;
+  // Number of executions left before the regexp is compiled to native code.
+  // Zero once the regexp uses native code.
+  static const int kIrregexpTicksUntilTierUpIndex = kDataIndex + 5;
+  // A literal string that every match contains, or Smi zero if none is known.
+  // Matching skips ahead to the occurrences of the literal.
+  static const int kIrregexpRequiredLiteralIndex = kDataIndex + 6;
+  // Minimal offset of the required literal from the start of a match.
+  static const int kIrregexpRequiredLiteralMinOffsetIndex = kDataIndex + 7;
+  // Maximal offset of the required literal from the start of a match, or -1
+  // if it is unbounded.
+  static const int kIrregexpRequiredLiteralMaxOffsetIndex = kDataIndex + 8;
+
+  static const int kIrregexpDataSize =
+      kIrregexpRequiredLiteralMaxOffsetIndex + 1;
 
   // In-object fields.
   static const int kLastIndexFieldIndex = 0;
@@ -132,6 +155,10 @@ class JSRegExp : public JSObject {
 
   // The uninitialized value for a regexp code object.
   static const int kUninitializedValue = -1;
+
+  // Subjects at least this long are matched with native code right away, as
+  // the interpreter would be much slower on them.
+  static const int kTierUpForSubjectLength = 1000;
 };
 
 DEFINE_OPERATORS_FOR_FLAGS(JSRegExp::Flags)
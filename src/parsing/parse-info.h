@@ -170,6 +170,16 @@ class V8_EXPORT_PRIVATE ParseInfo {
     max_function_literal_id_ = max_function_literal_id;
   }
 
+  // Function literal ids of large, lazily parsed top-level functions which
+  // can be parsed and compiled in parallel after the script has been
+  // compiled (see --parallel-compile-top-level-functions).
+  const std::vector<int>& parallel_compile_candidates() const {
+    return parallel_compile_candidates_;
+  }
+  void set_parallel_compile_candidates(std::vector<int> candidates) {
+    parallel_compile_candidates_ = std::move(candidates);
+  }
+
   const AstStringConstants* ast_string_constants() const {
     return ast_string_constants_;
   }
@@ -273,6 +283,7 @@ class V8_EXPORT_PRIVATE ParseInfo {
   int parameters_end_pos_;
   int function_literal_id_;
   int max_function_literal_id_;
+  std::vector<int> parallel_compile_candidates_;
 
   // TODO(titzer): Move handles out of ParseInfo.
   Handle<Script> script_;
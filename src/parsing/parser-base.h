@@ -3934,9 +3934,14 @@ typename ParserBase<Impl>::BlockT ParserBase<Impl>::ParseVariableDeclarations(
       value_beg_position = peek_position();
 
       ExpressionClassifier classifier(this);
-      value = ParseAssignmentExpression(var_context != kForStatement,
-                                        CHECK_OK_CUSTOM(NullStatement));
-      ValidateExpression(CHECK_OK_CUSTOM(NullStatement));
+      if (var_context != kForStatement) {
+        value = impl()->ParseJsonLiteralInitializer();
+      }
+      if (impl()->IsNull(value)) {
+        value = ParseAssignmentExpression(var_context != kForStatement,
+                                          CHECK_OK_CUSTOM(NullStatement));
+        ValidateExpression(CHECK_OK_CUSTOM(NullStatement));
+      }
       variable_loc.end_pos = scanner()->location().end_pos;
 
       if (!parsing_result->first_initializer_loc.IsValid()) {
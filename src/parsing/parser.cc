@@ -324,6 +324,41 @@ Expression* Parser::ImportMetaExpression(int pos) {
       new (zone()) ZoneList<Expression*>(0, zone()), pos);
 }
 
+Expression* Parser::ParseJsonLiteralInitializer() {
+  // Top-level code usually runs only once, so large data-only initializers
+  // of its declarations, e.g. "var config = {...};", aren't parsed into the
+  // AST. The scanner merely validates them as JSON text, and when the
+  // declaration runs, the JSON parser creates the value from the script
+  // source. This skips both the AST and the boilerplate description the
+  // bytecode generator would otherwise build for the literal.
+  if (!FLAG_json_literal_initializers) return nullptr;
+  if (!scope()->is_script_scope() && !scope()->is_module_scope()) {
+    return nullptr;
+  }
+  if (peek() != Token::LBRACE && peek() != Token::LBRACK) return nullptr;
+
+  int pos = peek_position();
+  Scanner::BookmarkScope bookmark(scanner());
+  bookmark.Set();
+  int end_pos =
+      scanner()->SkipJsonLiteral(FLAG_json_literal_initializer_min_size);
+  if (end_pos == kNoSourcePosition) return nullptr;
+
+  // The literal has to be the whole initializer, e.g. not the object of a
+  // following property access or call.
+  Token::Value next = peek();
+  if (next != Token::SEMICOLON && next != Token::COMMA &&
+      next != Token::EOS &&
+      !(scanner()->HasAnyLineTerminatorBeforeNext() &&
+        (next == Token::IDENTIFIER || next == Token::VAR ||
+         next == Token::LET || next == Token::CONST))) {
+    bookmark.Apply();
+    return nullptr;
+  }
+
+  return factory()->NewJsonLiteral(pos, end_pos);
+}
+
 Literal* Parser::ExpressionFromLiteral(Token::Value token, int pos) {
   switch (token) {
     case Token::NULL_LITERAL:
@@ -419,6 +454,7 @@ Parser::Parser(ParseInfo* info)
       total_preparse_skipped_(0),
       temp_zoned_(false),
       consumed_preparsed_scope_data_(info->consumed_preparsed_scope_data()),
+      record_parallel_compile_candidates_(false),
       parameters_end_pos_(info->parameters_end_pos()) {
   // Even though we were passed ParseInfo, we should not store it in
   // Parser - this makes sure that Isolate is not accidentally accessed via
@@ -540,6 +576,8 @@ FunctionLiteral* Parser::DoParseProgram(ParseInfo* info) {
 
   ParsingModeScope mode(this, allow_lazy_ ? PARSE_LAZILY : PARSE_EAGERLY);
   ResetFunctionLiteralId();
+  record_parallel_compile_candidates_ =
+      FLAG_parallel_compile_top_level_functions && !info->is_eval();
   DCHECK(info->function_literal_id() == FunctionLiteral::kIdTypeTopLevel ||
          info->function_literal_id() == FunctionLiteral::kIdTypeInvalid);
 
@@ -632,6 +670,8 @@ FunctionLiteral* Parser::DoParseProgram(ParseInfo* info) {
   }
 
   info->set_max_function_literal_id(GetLastFunctionLiteralId());
+  info->set_parallel_compile_candidates(
+      std::move(parallel_compile_candidates_));
 
   // Make sure the target stack is empty.
   DCHECK_NULL(target_stack_);
@@ -2698,6 +2738,16 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
       function_length, duplicate_parameters, function_type, eager_compile_hint,
       pos, true, function_literal_id, produced_preparsed_scope_data);
   function_literal->set_function_token_position(function_token_pos);
+
+  // Large top-level functions which were preparsed are candidates for being
+  // fully parsed and compiled on a background thread once the script itself
+  // has been compiled.
+  if (record_parallel_compile_candidates_ && should_preparse &&
+      is_lazy_top_level_function &&
+      scope->end_position() - scope->start_position() >=
+          FLAG_parallel_compile_min_function_size) {
+    parallel_compile_candidates_.push_back(function_literal_id);
+  }
   function_literal->set_suspend_count(suspend_count);
 
   if (should_infer_name) {
@@ -839,6 +839,10 @@ class V8_EXPORT_PRIVATE Parser : public NON_EXPORTED_BASE(ParserBase<Parser>) {
   Expression* NewTargetExpression(int pos);
   Expression* ImportMetaExpression(int pos);
 
+  // Returns nullptr unless the initializer at the peek'ed token is a large
+  // JSON literal that is better created with the JSON parser.
+  Expression* ParseJsonLiteralInitializer();
+
   Literal* ExpressionFromLiteral(Token::Value token, int pos);
 
   V8_INLINE VariableProxy* ExpressionFromIdentifier(
@@ -1105,6 +1109,10 @@ class V8_EXPORT_PRIVATE Parser : public NON_EXPORTED_BASE(ParserBase<Parser>) {
   bool allow_lazy_;
   bool temp_zoned_;
   ConsumedPreParsedScopeData* consumed_preparsed_scope_data_;
+  // Candidates are only recorded while parsing a script, since a lazy parse
+  // of a single function has no way to hand them on.
+  bool record_parallel_compile_candidates_;
+  std::vector<int> parallel_compile_candidates_;
 
   // If not kNoSourcePosition, indicates that the first function literal
   // encountered is a dynamic function, see CreateDynamicFunction(). This field
@@ -776,6 +776,7 @@ NOT_A_PATTERN(GetIterator)
 NOT_A_PATTERN(GetTemplateObject)
 NOT_A_PATTERN(IfStatement)
 NOT_A_PATTERN(ImportCallExpression)
+NOT_A_PATTERN(JsonLiteral)
 NOT_A_PATTERN(Literal)
 NOT_A_PATTERN(NativeFunctionLiteral)
 NOT_A_PATTERN(RegExpLiteral)
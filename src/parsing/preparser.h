@@ -1471,6 +1471,10 @@ class PreParser : public ParserBase<PreParser> {
   V8_INLINE void InsertShadowingVarBindingInitializers(
       PreParserStatement block) {}
 
+  V8_INLINE PreParserExpression ParseJsonLiteralInitializer() {
+    return PreParserExpression::Null();
+  }
+
   V8_INLINE PreParserExpression
   NewThrowReferenceError(MessageTemplate::Template message, int pos) {
     return PreParserExpression::Default();
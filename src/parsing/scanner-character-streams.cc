@@ -145,51 +145,6 @@ bool ExternalTwoByteStringUtf16CharacterStream::ReadBlock() {
   return have_data;
 }
 
-// ----------------------------------------------------------------------------
-// ExternalOneByteStringUtf16CharacterStream
-//
-// A stream whose data source is a Handle<ExternalOneByteString>.
-
-class ExternalOneByteStringUtf16CharacterStream
-    : public BufferedUtf16CharacterStream {
- public:
-  ExternalOneByteStringUtf16CharacterStream(Handle<ExternalOneByteString> data,
-                                            size_t start_position,
-                                            size_t end_position);
-
-  // For testing:
-  ExternalOneByteStringUtf16CharacterStream(const char* data, size_t length);
-
-  bool can_access_heap() override { return false; }
-
- protected:
-  size_t FillBuffer(size_t position) override;
-
-  const uint8_t* raw_data_;  // Pointer to the actual array of characters.
-  size_t length_;
-};
-
-ExternalOneByteStringUtf16CharacterStream::
-    ExternalOneByteStringUtf16CharacterStream(
-        Handle<ExternalOneByteString> data, size_t start_position,
-        size_t end_position)
-    : raw_data_(data->GetChars()), length_(end_position) {
-  DCHECK(end_position >= start_position);
-  buffer_pos_ = start_position;
-}
-
-ExternalOneByteStringUtf16CharacterStream::
-    ExternalOneByteStringUtf16CharacterStream(const char* data, size_t length)
-    : raw_data_(reinterpret_cast<const uint8_t*>(data)), length_(length) {}
-
-size_t ExternalOneByteStringUtf16CharacterStream::FillBuffer(size_t from_pos) {
-  if (from_pos >= length_) return 0;
-
-  size_t length = Min(kBufferSize, length_ - from_pos);
-  i::CopyCharsUnsigned(buffer_, raw_data_ + from_pos, length);
-  return length;
-}
-
 // ----------------------------------------------------------------------------
 // Utf8ExternalStreamingStream - chunked streaming of Utf-8 data.
 //
@@ -274,6 +229,14 @@ bool Utf8ExternalStreamingStream::SkipToPosition(size_t position) {
   size_t it = current_.pos.bytes - chunk.start.bytes;
   size_t chars = chunk.start.chars;
   while (it < chunk.length && chars < position) {
+    // Runs of ASCII characters are skipped in bulk.
+    if (state == unibrow::Utf8::State::kAccept) {
+      size_t length = unibrow::Utf8::NonAsciiStart(
+          chunk.data + it, i::Min(chunk.length - it, position - chars));
+      it += length;
+      chars += length;
+      if (it == chunk.length || chars == position) break;
+    }
     unibrow::uchar t = unibrow::Utf8::ValueOfIncremental(
         chunk.data[it], &it, &state, &incomplete_char);
     if (t == kUtf8Bom && current_.pos.chars == 0) {
@@ -325,6 +288,19 @@ void Utf8ExternalStreamingStream::FillBufferFromCurrentChunk() {
 
   size_t it = current_.pos.bytes - chunk.start.bytes;
   while (it < chunk.length && cursor + 1 < buffer_start_ + kBufferSize) {
+    // Runs of ASCII characters need no decoding and are widened in bulk.
+    if (state == unibrow::Utf8::State::kAccept &&
+        chunk.data[it] <= unibrow::Utf8::kMaxOneByteChar) {
+      size_t max_length =
+          i::Min(chunk.length - it,
+                 static_cast<size_t>(buffer_start_ + kBufferSize - 1 - cursor));
+      size_t length =
+          unibrow::Utf8::NonAsciiStart(chunk.data + it, max_length);
+      i::CopyCharsUnsigned(cursor, chunk.data + it, length);
+      cursor += length;
+      it += length;
+      continue;
+    }
     unibrow::uchar t = unibrow::Utf8::ValueOfIncremental(
         chunk.data[it], &it, &state, &incomplete_char);
     if (V8_LIKELY(t < kUtf8Bom)) {
@@ -538,37 +514,120 @@ size_t FindChunk(Chunks& chunks, ScriptCompiler::ExternalSourceStream* source,
 }  // anonymous namespace
 
 // ----------------------------------------------------------------------------
-// OneByteExternalStreamingStream
+// BufferedOneByteCharacterStream
+//
+// A buffered stream over a source of one-byte (latin-1) characters. All
+// one-byte sources - sequential and external one-byte strings, slices of
+// those, and one-byte streamed sources - share this implementation, which
+// widens the characters into buffer_ in bulk. The source is described by a
+// ByteStream, which provides:
 //
-// A stream of latin-1 encoded, chunked data.
+//   Range<uint8_t> GetDataAt(size_t pos);
+//   static const bool kCanAccessHeap;
+//
+// GetDataAt returns the (possibly empty) contiguous run of characters
+// starting at pos. The range is only valid until the next heap allocation.
+
+template <typename Char>
+struct Range {
+  const Char* start;
+  const Char* end;
+
+  size_t length() const { return static_cast<size_t>(end - start); }
+  bool empty() const { return start == end; }
+};
 
-class OneByteExternalStreamingStream : public BufferedUtf16CharacterStream {
+// A ByteStream over a sequential one-byte string on the V8 heap. The string
+// may move during GC, so the data pointer is re-read for every block.
+class OnHeapOneByteStream {
  public:
-  explicit OneByteExternalStreamingStream(
-      ScriptCompiler::ExternalSourceStream* source, RuntimeCallStats* stats)
+  OnHeapOneByteStream(Handle<SeqOneByteString> string, size_t start_offset,
+                      size_t end)
+      : string_(string), start_offset_(start_offset), length_(end) {}
+
+  Range<uint8_t> GetDataAt(size_t pos) {
+    if (pos >= length_) return {nullptr, nullptr};
+    DisallowHeapAllocation no_gc;
+    const uint8_t* data = string_->GetChars() + start_offset_;
+    return {data + pos, data + length_};
+  }
+
+  static const bool kCanAccessHeap = true;
+
+ private:
+  Handle<SeqOneByteString> string_;
+  size_t start_offset_;
+  size_t length_;
+};
+
+// A ByteStream over off-heap one-byte data, e.g. the resource of an external
+// one-byte string.
+class ExternalOneByteStream {
+ public:
+  ExternalOneByteStream(const uint8_t* data, size_t end)
+      : data_(data), length_(end) {}
+
+  Range<uint8_t> GetDataAt(size_t pos) {
+    if (pos >= length_) return {nullptr, nullptr};
+    return {data_ + pos, data_ + length_};
+  }
+
+  static const bool kCanAccessHeap = false;
+
+ private:
+  const uint8_t* data_;
+  size_t length_;
+};
+
+// A ByteStream over latin-1 encoded, chunked data.
+class ChunkedOneByteStream {
+ public:
+  ChunkedOneByteStream(ScriptCompiler::ExternalSourceStream* source,
+                       RuntimeCallStats* stats)
       : source_(source), stats_(stats) {}
-  ~OneByteExternalStreamingStream() override { DeleteChunks(chunks_); }
+  ~ChunkedOneByteStream() { DeleteChunks(chunks_); }
 
-  bool can_access_heap() override { return false; }
+  Range<uint8_t> GetDataAt(size_t pos) {
+    const Chunk& chunk = chunks_[FindChunk(chunks_, source_, pos, stats_)];
+    if (chunk.byte_length == 0) return {nullptr, nullptr};
+    const uint8_t* start = chunk.data + (pos - chunk.byte_pos);
+    return {start, chunk.data + chunk.byte_length};
+  }
 
- protected:
-  size_t FillBuffer(size_t position) override;
+  static const bool kCanAccessHeap = false;
 
  private:
   Chunks chunks_;
   ScriptCompiler::ExternalSourceStream* source_;
   RuntimeCallStats* stats_;
+
+  DISALLOW_COPY_AND_ASSIGN(ChunkedOneByteStream);
 };
 
-size_t OneByteExternalStreamingStream::FillBuffer(size_t position) {
-  const Chunk& chunk = chunks_[FindChunk(chunks_, source_, position, stats_)];
-  if (chunk.byte_length == 0) return 0;
+template <class ByteStream>
+class BufferedOneByteCharacterStream : public BufferedUtf16CharacterStream {
+ public:
+  template <class... TArgs>
+  explicit BufferedOneByteCharacterStream(size_t pos, TArgs... args)
+      : byte_stream_(args...) {
+    buffer_pos_ = pos;
+  }
 
-  size_t start_pos = position - chunk.byte_pos;
-  size_t len = i::Min(kBufferSize, chunk.byte_length - start_pos);
-  i::CopyCharsUnsigned(buffer_, chunk.data + start_pos, len);
-  return len;
-}
+  bool can_access_heap() override { return ByteStream::kCanAccessHeap; }
+
+ protected:
+  size_t FillBuffer(size_t position) override {
+    Range<uint8_t> range = byte_stream_.GetDataAt(position);
+    if (range.empty()) return 0;
+
+    size_t length = i::Min(kBufferSize, range.length());
+    i::CopyCharsUnsigned(buffer_, range.start, length);
+    return length;
+  }
+
+ private:
+  ByteStream byte_stream_;
+};
 
 #if !(V8_TARGET_ARCH_MIPS || V8_TARGET_ARCH_MIPS64)
 // ----------------------------------------------------------------------------
@@ -843,10 +902,29 @@ Utf16CharacterStream* ScannerStream::For(Handle<String> data, int start_pos,
   DCHECK_GE(start_pos, 0);
   DCHECK_LE(start_pos, end_pos);
   DCHECK_LE(end_pos, data->length());
-  if (data->IsExternalOneByteString()) {
-    return new ExternalOneByteStringUtf16CharacterStream(
-        Handle<ExternalOneByteString>::cast(data),
-        static_cast<size_t>(start_pos), static_cast<size_t>(end_pos));
+  // Look through slices and thin strings, so that one-byte data can be read
+  // directly from its underlying sequential or external string.
+  Handle<String> source = data;
+  size_t start_offset = 0;
+  if (source->IsSlicedString()) {
+    SlicedString* string = SlicedString::cast(*source);
+    start_offset = string->offset();
+    String* parent = string->parent();
+    if (parent->IsThinString()) parent = ThinString::cast(parent)->actual();
+    source = handle(parent, source->GetIsolate());
+  } else if (source->IsThinString()) {
+    source = handle(ThinString::cast(*source)->actual(), source->GetIsolate());
+  }
+  if (source->IsExternalOneByteString()) {
+    return new BufferedOneByteCharacterStream<ExternalOneByteStream>(
+        static_cast<size_t>(start_pos),
+        ExternalOneByteString::cast(*source)->GetChars() + start_offset,
+        static_cast<size_t>(end_pos));
+  } else if (source->IsSeqOneByteString()) {
+    return new BufferedOneByteCharacterStream<OnHeapOneByteStream>(
+        static_cast<size_t>(start_pos),
+        Handle<SeqOneByteString>::cast(source), start_offset,
+        static_cast<size_t>(end_pos));
   } else if (data->IsExternalTwoByteString()) {
     return new ExternalTwoByteStringUtf16CharacterStream(
         Handle<ExternalTwoByteString>::cast(data),
@@ -866,7 +944,9 @@ std::unique_ptr<Utf16CharacterStream> ScannerStream::ForTesting(
 std::unique_ptr<Utf16CharacterStream> ScannerStream::ForTesting(
     const char* data, size_t length) {
   return std::unique_ptr<Utf16CharacterStream>(
-      new ExternalOneByteStringUtf16CharacterStream(data, length));
+      new BufferedOneByteCharacterStream<ExternalOneByteStream>(
+          static_cast<size_t>(0), reinterpret_cast<const uint8_t*>(data),
+          length));
 }
 
 Utf16CharacterStream* ScannerStream::For(
@@ -881,7 +961,8 @@ Utf16CharacterStream* ScannerStream::For(
       return new TwoByteExternalBufferedStream(source_stream, stats);
 #endif
     case v8::ScriptCompiler::StreamedSource::ONE_BYTE:
-      return new OneByteExternalStreamingStream(source_stream, stats);
+      return new BufferedOneByteCharacterStream<ChunkedOneByteStream>(
+          static_cast<size_t>(0), source_stream, stats);
     case v8::ScriptCompiler::StreamedSource::UTF8:
       return new Utf8ExternalStreamingStream(source_stream, stats);
   }
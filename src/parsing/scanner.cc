@@ -16,6 +16,7 @@
 #include "src/objects/bigint.h"
 #include "src/parsing/duplicate-finder.h"  // For Scanner::FindSymbol
 #include "src/unicode-cache-inl.h"
+#include "src/word-lanes.h"
 
 namespace v8 {
 namespace internal {
@@ -56,6 +57,60 @@ class Scanner::ErrorState {
   Scanner::Location const old_location_;
 };
 
+// ----------------------------------------------------------------------------
+// Utf16CharacterStream
+
+namespace {
+
+inline bool IsWordAligned(const uint16_t* cursor) {
+  return IsAligned(reinterpret_cast<uintptr_t>(cursor), sizeof(uintptr_t));
+}
+
+}  // namespace
+
+// static
+const uint16_t* Utf16CharacterStream::FindAsciiStop(const uint16_t* cursor,
+                                                    const uint16_t* end,
+                                                    char stop1, char stop2,
+                                                    char stop3, char stop4) {
+  auto is_stop = [=](uint16_t c) {
+    return c > unibrow::Utf8::kMaxOneByteChar || c == stop1 || c == stop2 ||
+           c == stop3 || c == stop4;
+  };
+  while (cursor < end && !IsWordAligned(cursor)) {
+    if (is_stop(*cursor)) return cursor;
+    cursor++;
+  }
+  while (end - cursor >= kUc16PerWord) {
+    uintptr_t word = *reinterpret_cast<const uintptr_t*>(cursor);
+    if ((word & kUc16NonAsciiMask) != 0 || HasUc16(word, stop1) ||
+        HasUc16(word, stop2) || HasUc16(word, stop3) || HasUc16(word, stop4)) {
+      break;
+    }
+    cursor += kUc16PerWord;
+  }
+  while (cursor < end && !is_stop(*cursor)) cursor++;
+  return cursor;
+}
+
+// static
+const uint16_t* Utf16CharacterStream::FindNotEqual(const uint16_t* cursor,
+                                                   const uint16_t* end,
+                                                   char c) {
+  const uint16_t value = static_cast<uint8_t>(c);
+  while (cursor < end && !IsWordAligned(cursor)) {
+    if (*cursor != value) return cursor;
+    cursor++;
+  }
+  const uintptr_t pattern = kOneInEveryUc16 * value;
+  while (end - cursor >= kUc16PerWord &&
+         *reinterpret_cast<const uintptr_t*>(cursor) == pattern) {
+    cursor += kUc16PerWord;
+  }
+  while (cursor < end && *cursor == value) cursor++;
+  return cursor;
+}
+
 // ----------------------------------------------------------------------------
 // Scanner::LiteralBuffer
 
@@ -447,6 +502,9 @@ Token::Value Scanner::SkipWhiteSpace() {
         has_line_terminator_before_next_ = true;
       } else if (!unicode_cache_->IsWhiteSpace(c0_)) {
         break;
+      } else if (c0_ == ' ') {
+        // Skip the rest of a run of spaces, e.g. indentation, in bulk.
+        source_->AdvanceRepeated(' ');
       }
       Advance();
     }
@@ -501,6 +559,7 @@ Token::Value Scanner::SkipSingleLineComment() {
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
   while (c0_ != kEndOfInput && !unibrow::IsLineTerminator(c0_)) {
+    source_->AdvanceAsciiRun('\n', '\r', '\n', '\r');
     Advance();
   }
 
@@ -575,6 +634,11 @@ Token::Value Scanner::SkipMultiLineComment() {
 
   while (c0_ != kEndOfInput) {
     uc32 ch = c0_;
+    // Skip ahead over a run of characters that can neither end the comment
+    // nor be line terminators.
+    if (ch != '*' && ch <= kMaxAscii && ch != '\n' && ch != '\r') {
+      source_->AdvanceAsciiRun('*', '\n', '\r', '*');
+    }
     Advance();
     if (c0_ != kEndOfInput && unibrow::IsLineTerminator(ch)) {
       // Following ECMA-262, section 7.4, a comment containing
@@ -971,6 +1035,169 @@ void Scanner::SeekForward(int pos) {
   Scan();
 }
 
+int Scanner::SkipJsonLiteral(int min_length) {
+  DCHECK(next_.token == Token::LBRACE || next_.token == Token::LBRACK);
+  if (next_next_.token != Token::UNINITIALIZED) return kNoSourcePosition;
+
+  // Remember the raw stream state, so that a failed attempt can be undone.
+  size_t stream_pos = source_->pos();
+  uc32 c0 = c0_;
+  bool is_object = next_.token == Token::LBRACE;
+  if (!SkipJsonContainer(is_object, 0) ||
+      source_pos() - next_.location.beg_pos < min_length) {
+    source_->Seek(stream_pos);
+    c0_ = c0;
+    return kNoSourcePosition;
+  }
+
+  // Let the opening bracket's token span the whole literal and make it the
+  // current one. The helpers advance by code units, so c0_ may still need
+  // to be combined with a trail surrogate before the next token is scanned.
+  next_.location.end_pos = source_pos();
+  HandleLeadSurrogate();
+  Next();
+  return current_.location.end_pos;
+}
+
+void Scanner::SkipJsonWhiteSpace() {
+  while (c0_ == ' ' || c0_ == '\t' || c0_ == '\n' || c0_ == '\r') {
+    if (c0_ == ' ') source_->AdvanceRepeated(' ');
+    Advance<false, false>();
+  }
+}
+
+bool Scanner::SkipJsonContainer(bool is_object, int depth) {
+  // The opening bracket has already been consumed.
+  uc32 close = is_object ? '}' : ']';
+  SkipJsonWhiteSpace();
+  if (c0_ == close) {
+    Advance<false, false>();
+    return true;
+  }
+  while (true) {
+    if (is_object) {
+      if (c0_ != '"' || !SkipJsonString(true)) return false;
+      SkipJsonWhiteSpace();
+      if (c0_ != ':') return false;
+      Advance<false, false>();
+      SkipJsonWhiteSpace();
+    }
+    if (!SkipJsonValue(depth)) return false;
+    SkipJsonWhiteSpace();
+    if (c0_ == close) {
+      Advance<false, false>();
+      return true;
+    }
+    if (c0_ != ',') return false;
+    Advance<false, false>();
+    SkipJsonWhiteSpace();
+  }
+}
+
+bool Scanner::SkipJsonValue(int depth) {
+  switch (c0_) {
+    case '"':
+      return SkipJsonString(false);
+    case '{':
+    case '[': {
+      if (depth == kMaxJsonLiteralDepth) return false;
+      bool is_object = c0_ == '{';
+      Advance<false, false>();
+      return SkipJsonContainer(is_object, depth + 1);
+    }
+    case 't':
+      return SkipJsonKeyword("true");
+    case 'f':
+      return SkipJsonKeyword("false");
+    case 'n':
+      return SkipJsonKeyword("null");
+    default:
+      return SkipJsonNumber();
+  }
+}
+
+bool Scanner::SkipJsonString(bool is_property_name) {
+  DCHECK_EQ('"', c0_);
+  Advance<false, false>();
+
+  // A "__proto__" property name sets the prototype in an object literal, but
+  // defines an own property in JSON.parse, so such literals are rejected.
+  // Escaped property names are rejected too, since they could spell it.
+  static const char kProto[] = "__proto__";
+  int proto_length = 0;
+  bool may_be_proto = is_property_name;
+  while (c0_ != '"') {
+    // JSON strings don't allow unescaped control characters, and JavaScript
+    // strings don't allow line terminators unless they subsume JSON.
+    if (c0_ < 0x20) return false;
+    if (!FLAG_harmony_subsume_json && unibrow::IsLineTerminator(c0_)) {
+      return false;
+    }
+    if (c0_ == '\\') {
+      if (is_property_name) return false;
+      Advance<false, false>();
+      switch (c0_) {
+        case '"':
+        case '\\':
+        case '/':
+        case 'b':
+        case 'f':
+        case 'n':
+        case 'r':
+        case 't':
+          break;
+        case 'u':
+          for (int i = 0; i < 4; i++) {
+            Advance<false, false>();
+            if (HexValue(c0_) < 0) return false;
+          }
+          break;
+        default:
+          return false;
+      }
+    } else if (may_be_proto) {
+      may_be_proto = proto_length < static_cast<int>(arraysize(kProto)) - 1 &&
+                     c0_ == kProto[proto_length];
+      proto_length++;
+    }
+    Advance<false, false>();
+  }
+  Advance<false, false>();  // consume quote
+  return !may_be_proto ||
+         proto_length != static_cast<int>(arraysize(kProto)) - 1;
+}
+
+bool Scanner::SkipJsonNumber() {
+  if (c0_ == '-') Advance<false, false>();
+  if (c0_ == '0') {
+    Advance<false, false>();
+  } else if (IsDecimalDigit(c0_)) {
+    while (IsDecimalDigit(c0_)) Advance<false, false>();
+  } else {
+    return false;
+  }
+  if (c0_ == '.') {
+    Advance<false, false>();
+    if (!IsDecimalDigit(c0_)) return false;
+    while (IsDecimalDigit(c0_)) Advance<false, false>();
+  }
+  if (c0_ == 'e' || c0_ == 'E') {
+    Advance<false, false>();
+    if (c0_ == '+' || c0_ == '-') Advance<false, false>();
+    if (!IsDecimalDigit(c0_)) return false;
+    while (IsDecimalDigit(c0_)) Advance<false, false>();
+  }
+  return true;
+}
+
+bool Scanner::SkipJsonKeyword(const char* keyword) {
+  for (const char* c = keyword; *c != '\0'; c++) {
+    if (c0_ != *c) return false;
+    Advance<false, false>();
+  }
+  return true;
+}
+
 
 template <bool capture_raw, bool in_template_literal>
 bool Scanner::ScanEscape() {
@@ -1069,8 +1296,11 @@ Token::Value Scanner::ScanString() {
     }
     char c = static_cast<char>(c0_);
     if (c == '\\') break;
-    Advance<false, false>();
     AddLiteralChar(c);
+    // Copy the rest of a run of plain ASCII characters in bulk.
+    next_.literal_chars->AddAsciiChars(source_->AdvanceAsciiRun(
+        static_cast<char>(quote), '\\', '\n', '\r'));
+    Advance<false, false>();
   }
 
   bool (*line_terminator_func)(unsigned int) =
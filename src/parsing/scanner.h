@@ -92,6 +92,24 @@ class Utf16CharacterStream {
     }
   }
 
+  // Advances past the longest run of buffered ASCII code units that contains
+  // none of the given stop characters, and returns that run. The run never
+  // extends beyond the current buffer, so an empty or short run does not mean
+  // that the next code unit is a stop character.
+  inline Vector<const uint16_t> AdvanceAsciiRun(char stop1, char stop2,
+                                                char stop3, char stop4) {
+    const uint16_t* start = buffer_cursor_;
+    buffer_cursor_ =
+        FindAsciiStop(buffer_cursor_, buffer_end_, stop1, stop2, stop3, stop4);
+    return Vector<const uint16_t>(start,
+                                  static_cast<int>(buffer_cursor_ - start));
+  }
+
+  // Advances past the buffered code units that are equal to c.
+  inline void AdvanceRepeated(char c) {
+    buffer_cursor_ = FindNotEqual(buffer_cursor_, buffer_end_, c);
+  }
+
   // Returns true if the stream could access the V8 heap after construction.
   virtual bool can_access_heap() = 0;
 
@@ -151,6 +169,16 @@ class Utf16CharacterStream {
   //   the start of the buffer.
   virtual bool ReadBlock() = 0;
 
+  // Word-at-a-time search kernels for AdvanceAsciiRun and AdvanceRepeated.
+  // FindAsciiStop returns the first code unit in [start, end) that is
+  // non-ASCII or one of the stop characters; FindNotEqual returns the first
+  // one that differs from c. Both return end if there is none.
+  static const uint16_t* FindAsciiStop(const uint16_t* start,
+                                       const uint16_t* end, char stop1,
+                                       char stop2, char stop3, char stop4);
+  static const uint16_t* FindNotEqual(const uint16_t* start,
+                                      const uint16_t* end, char c);
+
   const uint16_t* buffer_start_;
   const uint16_t* buffer_cursor_;
   const uint16_t* buffer_end_;
@@ -326,6 +354,15 @@ class Scanner {
   // tokens, which is what it is used for.
   void SeekForward(int pos);
 
+  // Skips over an object or array literal that starts at the peek'ed '{' or
+  // '[' token and consists of plain JSON text, i.e. text that JSON.parse
+  // accepts and that evaluates to the same value as a JavaScript expression.
+  // If the literal spans at least min_length characters, it becomes the
+  // current token, the token after it is peek'ed and its end position is
+  // returned. Otherwise the scanner is left untouched and kNoSourcePosition
+  // is returned.
+  int SkipJsonLiteral(int min_length);
+
   // Returns true if there was a line terminator before the peek'ed token,
   // possibly inside a multi-line comment.
   bool HasAnyLineTerminatorBeforeNext() const {
@@ -417,6 +454,18 @@ class Scanner {
       }
     }
 
+    // Adds a run of ASCII code units, e.g. as returned by
+    // Utf16CharacterStream::AdvanceAsciiRun.
+    void AddAsciiChars(Vector<const uint16_t> chars) {
+      DCHECK(is_one_byte_);
+      while (position_ + chars.length() > backing_store_.length()) {
+        ExpandBuffer();
+      }
+      CopyChars(backing_store_.start() + position_, chars.start(),
+                chars.length());
+      position_ += chars.length() * kOneByteSize;
+    }
+
     bool is_one_byte() const { return is_one_byte_; }
 
     bool Equals(Vector<const char> keyword) const {
@@ -755,6 +804,16 @@ class Scanner {
   Token::Value ScanString();
   Token::Value ScanPrivateName();
 
+  // Helpers for SkipJsonLiteral. Each skips one piece of JSON text starting
+  // at c0_ and returns false if the source isn't valid JSON there.
+  static const int kMaxJsonLiteralDepth = 64;
+  bool SkipJsonValue(int depth);
+  bool SkipJsonContainer(bool is_object, int depth);
+  bool SkipJsonString(bool is_property_name);
+  bool SkipJsonNumber();
+  bool SkipJsonKeyword(const char* keyword);
+  void SkipJsonWhiteSpace();
+
   // Scans an escape-sequence which is part of a string and adds the
   // decoded character to the current literal. Returns true if a pattern
   // is scanned.
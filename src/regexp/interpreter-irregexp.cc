@@ -4,11 +4,11 @@
 
 // A simple interpreter for the Irregexp byte code.
 
-#ifdef V8_INTERPRETED_REGEXP
-
 #include "src/regexp/interpreter-irregexp.h"
 
 #include "src/ast/ast.h"
+#include "src/base/optional.h"
+#include "src/isolate.h"
 #include "src/objects-inl.h"
 #include "src/regexp/bytecodes-irregexp.h"
 #include "src/regexp/jsregexp.h"
@@ -151,12 +151,53 @@ class BacktrackStack {
 
 
 template <typename Char>
-static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
-                                           const byte* code_base,
-                                           Vector<const Char> subject,
-                                           int* registers,
-                                           int current,
-                                           uint32_t current_char) {
+static Vector<const Char> GetCharVector(Handle<String> string);
+
+template <>
+Vector<const uint8_t> GetCharVector(Handle<String> string) {
+  String::FlatContent content = string->GetFlatContent();
+  DCHECK(content.IsOneByte());
+  return content.ToOneByteVector();
+}
+
+template <>
+Vector<const uc16> GetCharVector(Handle<String> string) {
+  String::FlatContent content = string->GetFlatContent();
+  DCHECK(content.IsTwoByte());
+  return content.ToUC16Vector();
+}
+
+
+// Handles a stack overflow or an interrupt, e.g. a GC request or
+// TerminateExecution, that the stack guard signalled while matching, like
+// NativeRegExpMacroAssembler::CheckStackGuardState does for native code.
+// Returns false if an exception is pending afterwards. A GC may have moved
+// the code and the subject, so the caller has to reload both.
+static bool HandleInterrupts(Isolate* isolate) {
+  StackLimitCheck check(isolate);
+  if (check.JsHasOverflowed()) {
+    isolate->StackOverflow();
+    return false;
+  }
+  Object* result = isolate->stack_guard()->HandleInterrupts();
+  return !result->IsException(isolate);
+}
+
+
+template <typename Char>
+static IrregexpInterpreter::Result RawMatch(Isolate* isolate,
+                                            Handle<ByteArray> code_array,
+                                            Handle<String> subject_string,
+                                            int* registers,
+                                            int current,
+                                            uint32_t current_char) {
+  // The code and the subject are accessed through raw pointers, which stay
+  // valid as long as there is no GC. The region is left while interrupts are
+  // handled, and the pointers are reloaded afterwards.
+  base::Optional<DisallowHeapAllocation> no_gc;
+  no_gc.emplace();
+  const byte* code_base = code_array->GetDataStartAddress();
+  Vector<const Char> subject = GetCharVector<Char>(subject_string);
   const byte* pc = code_base;
   // BacktrackStack ensures that the memory allocated for the backtracking stack
   // is returned to the system or cached if there is no stack being cached at
@@ -177,21 +218,21 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         UNREACHABLE();
       BYTECODE(PUSH_CP)
         if (--backtrack_stack_space < 0) {
-          return RegExpImpl::RE_EXCEPTION;
+          return IrregexpInterpreter::EXCEPTION;
         }
         *backtrack_sp++ = current;
         pc += BC_PUSH_CP_LENGTH;
         break;
       BYTECODE(PUSH_BT)
         if (--backtrack_stack_space < 0) {
-          return RegExpImpl::RE_EXCEPTION;
+          return IrregexpInterpreter::EXCEPTION;
         }
         *backtrack_sp++ = Load32Aligned(pc + 4);
         pc += BC_PUSH_BT_LENGTH;
         break;
       BYTECODE(PUSH_REGISTER)
         if (--backtrack_stack_space < 0) {
-          return RegExpImpl::RE_EXCEPTION;
+          return IrregexpInterpreter::EXCEPTION;
         }
         *backtrack_sp++ = registers[insn >> BYTECODE_SHIFT];
         pc += BC_PUSH_REGISTER_LENGTH;
@@ -229,11 +270,33 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         current = *backtrack_sp;
         pc += BC_POP_CP_LENGTH;
         break;
-      BYTECODE(POP_BT)
+      BYTECODE(POP_BT) {
         backtrack_stack_space++;
         --backtrack_sp;
-        pc = code_base + *backtrack_sp;
+        int pc_offset = *backtrack_sp;
+        // Every backtrack checks the stack guard, so that catastrophic
+        // backtracking can still be interrupted or terminated.
+        if (StackLimitCheck(isolate).InterruptRequested()) {
+          bool was_one_byte =
+              subject_string->IsOneByteRepresentationUnderneath();
+          no_gc.reset();
+          if (!HandleInterrupts(isolate)) {
+            return IrregexpInterpreter::EXCEPTION;
+          }
+          // If the subject changed between one-byte and two-byte, e.g. by
+          // being externalized, the match has to start over with the code
+          // for the new representation.
+          if (subject_string->IsOneByteRepresentationUnderneath() !=
+              was_one_byte) {
+            return IrregexpInterpreter::RETRY;
+          }
+          no_gc.emplace();
+          code_base = code_array->GetDataStartAddress();
+          subject = GetCharVector<Char>(subject_string);
+        }
+        pc = code_base + pc_offset;
         break;
+      }
       BYTECODE(POP_REGISTER)
         backtrack_stack_space++;
         --backtrack_sp;
@@ -241,9 +304,9 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
         pc += BC_POP_REGISTER_LENGTH;
         break;
       BYTECODE(FAIL)
-        return RegExpImpl::RE_FAILURE;
+        return IrregexpInterpreter::FAILURE;
       BYTECODE(SUCCEED)
-        return RegExpImpl::RE_SUCCESS;
+        return IrregexpInterpreter::SUCCESS;
       BYTECODE(ADVANCE_CP)
         current += insn >> BYTECODE_SHIFT;
         pc += BC_ADVANCE_CP_LENGTH;
@@ -587,7 +650,7 @@ static RegExpImpl::IrregexpResult RawMatch(Isolate* isolate,
 }
 
 
-RegExpImpl::IrregexpResult IrregexpInterpreter::Match(
+IrregexpInterpreter::Result IrregexpInterpreter::Match(
     Isolate* isolate,
     Handle<ByteArray> code_array,
     Handle<String> subject,
@@ -595,33 +658,32 @@ RegExpImpl::IrregexpResult IrregexpInterpreter::Match(
     int start_position) {
   DCHECK(subject->IsFlat());
 
-  DisallowHeapAllocation no_gc;
-  const byte* code_base = code_array->GetDataStartAddress();
   uc16 previous_char = '\n';
-  String::FlatContent subject_content = subject->GetFlatContent();
-  if (subject_content.IsOneByte()) {
-    Vector<const uint8_t> subject_vector = subject_content.ToOneByteVector();
-    if (start_position != 0) previous_char = subject_vector[start_position - 1];
-    return RawMatch(isolate,
-                    code_base,
-                    subject_vector,
-                    registers,
-                    start_position,
-                    previous_char);
+  bool is_one_byte;
+  {
+    DisallowHeapAllocation no_gc;
+    String::FlatContent subject_content = subject->GetFlatContent();
+    if (start_position != 0) {
+      previous_char = subject_content.Get(start_position - 1);
+    }
+    is_one_byte = subject_content.IsOneByte();
+  }
+  if (is_one_byte) {
+    return RawMatch<uint8_t>(isolate,
+                             code_array,
+                             subject,
+                             registers,
+                             start_position,
+                             previous_char);
   } else {
-    DCHECK(subject_content.IsTwoByte());
-    Vector<const uc16> subject_vector = subject_content.ToUC16Vector();
-    if (start_position != 0) previous_char = subject_vector[start_position - 1];
-    return RawMatch(isolate,
-                    code_base,
-                    subject_vector,
-                    registers,
-                    start_position,
-                    previous_char);
+    return RawMatch<uc16>(isolate,
+                          code_array,
+                          subject,
+                          registers,
+                          start_position,
+                          previous_char);
   }
 }
 
 }  // namespace internal
 }  // namespace v8
-
-#endif  // V8_INTERPRETED_REGEXP
@@ -7,8 +7,6 @@
 #ifndef V8_REGEXP_INTERPRETER_IRREGEXP_H_
 #define V8_REGEXP_INTERPRETER_IRREGEXP_H_
 
-#ifdef V8_INTERPRETED_REGEXP
-
 #include "src/regexp/jsregexp.h"
 
 namespace v8 {
@@ -16,17 +14,21 @@ namespace internal {
 
 class IrregexpInterpreter {
  public:
-  static RegExpImpl::IrregexpResult Match(Isolate* isolate,
-                                          Handle<ByteArray> code,
-                                          Handle<String> subject,
-                                          int* captures,
-                                          int start_position);
+  // Like RegExpImpl::IrregexpResult. EXCEPTION without a pending exception
+  // means the backtrack stack overflowed. RETRY means the subject changed
+  // representation while an interrupt was handled, and the match has to be
+  // restarted with the code for the new one.
+  enum Result { RETRY = -2, EXCEPTION = -1, FAILURE = 0, SUCCESS = 1 };
+
+  static Result Match(Isolate* isolate,
+                      Handle<ByteArray> code,
+                      Handle<String> subject,
+                      int* captures,
+                      int start_position);
 };
 
 
 }  // namespace internal
 }  // namespace v8
 
-#endif  // V8_INTERPRETED_REGEXP
-
 #endif  // V8_REGEXP_INTERPRETER_IRREGEXP_H_
@@ -53,11 +53,19 @@ int32_t* RegExpImpl::GlobalCache::FetchNext() {
         num_matches_ = 0;  // Signal failed match.
         return nullptr;
       }
-      num_matches_ = RegExpImpl::IrregexpExecRaw(regexp_,
-                                                 subject_,
+      if (regexp_->TypeTag() == JSRegExp::LINEAR) {
+        num_matches_ = RegExpImpl::LinearExecRaw(regexp_, subject_,
                                                  last_end_index,
                                                  register_array_,
                                                  register_array_size_);
+      } else {
+        num_matches_ = RegExpImpl::IrregexpExecRaw(regexp_,
+                                                   subject_,
+                                                   last_end_index,
+                                                   register_array_,
+                                                   register_array_size_,
+                                                   use_bytecode_);
+      }
     }
 
     if (num_matches_ <= 0) return nullptr;
@@ -17,8 +17,10 @@
 #include "src/ostreams.h"
 #include "src/regexp/interpreter-irregexp.h"
 #include "src/regexp/jsregexp-inl.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "src/regexp/regexp-macro-assembler-irregexp.h"
 #include "src/regexp/regexp-macro-assembler-tracer.h"
+#include "src/regexp/regexp-linear.h"
 #include "src/regexp/regexp-macro-assembler.h"
 #include "src/regexp/regexp-parser.h"
 #include "src/regexp/regexp-stack.h"
@@ -126,6 +128,117 @@ static bool HasFewDifferentCharacters(Handle<String> pattern) {
   return true;
 }
 
+// Finds the longest literal string that every match of a pattern contains,
+// with the minimal and maximal offset of the literal from the start of the
+// match. Only the top-level sequence of the pattern, the groups in it, and
+// the first iteration of the quantifiers in it are looked at.
+class RequiredLiteralFinder {
+ public:
+  explicit RequiredLiteralFinder(RegExpTree* tree)
+      : min_offset_(0),
+        max_offset_(0),
+        run_min_offset_(0),
+        run_max_offset_(0),
+        literal_min_offset_(0),
+        literal_max_offset_(0) {
+    Visit(tree);
+    EndRun();
+  }
+
+  Vector<const uc16> literal() const {
+    return Vector<const uc16>(literal_.data(),
+                              static_cast<int>(literal_.size()));
+  }
+  int min_offset() const { return literal_min_offset_; }
+  // RegExpTree::kInfinity if the offset of the literal is unbounded.
+  int max_offset() const { return literal_max_offset_; }
+
+ private:
+  static int Add(int a, int b) {
+    DCHECK_LE(0, a);
+    DCHECK_LE(0, b);
+    return a > RegExpTree::kInfinity - b ? RegExpTree::kInfinity : a + b;
+  }
+
+  void Visit(RegExpTree* tree) {
+    if (tree->IsAlternative()) {
+      ZoneList<RegExpTree*>* nodes = tree->AsAlternative()->nodes();
+      for (int i = 0; i < nodes->length(); i++) Visit(nodes->at(i));
+    } else if (tree->IsCapture()) {
+      Visit(tree->AsCapture()->body());
+    } else if (tree->IsGroup()) {
+      Visit(tree->AsGroup()->body());
+    } else if (tree->IsAtom()) {
+      VisitAtom(tree->AsAtom());
+    } else if (tree->IsText()) {
+      ZoneList<TextElement>* elements = tree->AsText()->elements();
+      for (int i = 0; i < elements->length(); i++) {
+        TextElement element = elements->at(i);
+        if (element.text_type() == TextElement::ATOM) {
+          VisitAtom(element.atom());
+        } else {
+          Skip(element.length(), element.length());
+        }
+      }
+    } else if (tree->IsQuantifier() && tree->AsQuantifier()->min() > 0) {
+      // The first iteration of the body is part of every match. Only its
+      // literals are used, as they are followed by further iterations.
+      RegExpQuantifier* quantifier = tree->AsQuantifier();
+      int min_offset = min_offset_;
+      int max_offset = max_offset_;
+      Visit(quantifier->body());
+      if (quantifier->max() > 1) EndRun();
+      min_offset_ = Add(min_offset, quantifier->min_match());
+      max_offset_ = Add(max_offset, quantifier->max_match());
+    } else if (tree->max_match() > 0) {
+      // Zero-width assertions do not end the current literal.
+      Skip(tree->min_match(), tree->max_match());
+    }
+  }
+
+  void VisitAtom(RegExpAtom* atom) {
+    if (atom->ignore_case()) {
+      Skip(atom->length(), atom->length());
+      return;
+    }
+    if (run_.empty()) {
+      run_min_offset_ = min_offset_;
+      run_max_offset_ = max_offset_;
+    }
+    Vector<const uc16> data = atom->data();
+    run_.insert(run_.end(), data.begin(), data.end());
+    min_offset_ = Add(min_offset_, atom->length());
+    max_offset_ = Add(max_offset_, atom->length());
+  }
+
+  void Skip(int min_match, int max_match) {
+    EndRun();
+    min_offset_ = Add(min_offset_, min_match);
+    max_offset_ = Add(max_offset_, max_match);
+  }
+
+  void EndRun() {
+    if (run_.size() > literal_.size()) {
+      literal_.swap(run_);
+      literal_min_offset_ = run_min_offset_;
+      literal_max_offset_ = run_max_offset_;
+    }
+    run_.clear();
+  }
+
+  // Offsets of the current position from the start of the match.
+  int min_offset_;
+  int max_offset_;
+  // The literal that ends at the current position.
+  std::vector<uc16> run_;
+  int run_min_offset_;
+  int run_max_offset_;
+  // The longest literal found so far.
+  std::vector<uc16> literal_;
+  int literal_min_offset_;
+  int literal_max_offset_;
+};
+
 // Generic RegExp methods. Dispatches to implementation specific methods.
 
 MaybeHandle<Object> RegExpImpl::Compile(Handle<JSRegExp> re,
@@ -174,8 +287,39 @@ MaybeHandle<Object> RegExpImpl::Compile(Handle<JSRegExp> re,
       has_been_compiled = true;
     }
   }
+  if (!has_been_compiled &&
+      (FLAG_regexp_linear || FLAG_regexp_linear_nested_quantifiers)) {
+    bool has_nested_quantifiers = false;
+    Handle<ByteArray> program;
+    if (RegExpLinear::Compile(isolate, &zone, parse_result.tree,
+                              &has_nested_quantifiers)
+            .ToHandle(&program) &&
+        (FLAG_regexp_linear || has_nested_quantifiers)) {
+      LinearInitialize(re, pattern, flags, parse_result.capture_count,
+                       parse_result.capture_name_map, program);
+      has_been_compiled = true;
+    }
+  }
   if (!has_been_compiled) {
     IrregexpInitialize(re, pattern, flags, parse_result.capture_count);
+    // Patterns anchored at either end are cheap to fail already, and sticky
+    // ones are only tried at a single position.
+    if (FLAG_regexp_required_literal && !IgnoreCase(flags) &&
+        !IsUnicode(flags) && !IsSticky(flags) &&
+        !parse_result.tree->IsAnchoredAtStart() &&
+        !parse_result.tree->IsAnchoredAtEnd()) {
+      RequiredLiteralFinder finder(parse_result.tree);
+      if (finder.literal().length() > 0 &&
+          finder.min_offset() <= String::kMaxLength) {
+        Handle<String> literal;
+        ASSIGN_RETURN_ON_EXCEPTION(
+            isolate, literal,
+            isolate->factory()->NewStringFromTwoByte(finder.literal()),
+            Object);
+        SetIrregexpRequiredLiteral(re, literal, finder.min_offset(),
+                                   finder.max_offset());
+      }
+    }
   }
   DCHECK(re->data()->IsFixedArray());
   // Compilation succeeded so the data is set on the regexp
@@ -195,6 +339,8 @@ MaybeHandle<Object> RegExpImpl::Exec(Handle<JSRegExp> regexp,
     case JSRegExp::IRREGEXP: {
       return IrregexpExec(regexp, subject, index, last_match_info);
     }
+    case JSRegExp::LINEAR:
+      return LinearExec(regexp, subject, index, last_match_info);
     default:
       UNREACHABLE();
   }
@@ -298,47 +444,132 @@ Handle<Object> RegExpImpl::AtomExec(Handle<JSRegExp> re, Handle<String> subject,
 }
 
 
+// Linear-time engine, see regexp-linear.h.
+
+void RegExpImpl::LinearInitialize(Handle<JSRegExp> re, Handle<String> pattern,
+                                  JSRegExp::Flags flags, int capture_count,
+                                  Handle<FixedArray> capture_name_map,
+                                  Handle<ByteArray> program) {
+  re->GetIsolate()->factory()->SetRegExpIrregexpData(
+      re, JSRegExp::LINEAR, pattern, flags, capture_count);
+  FixedArray* data = FixedArray::cast(re->data());
+  // The program works for both one-byte and two-byte subjects.
+  data->set(JSRegExp::kIrregexpLatin1CodeIndex, *program);
+  data->set(JSRegExp::kIrregexpUC16CodeIndex, *program);
+  SetIrregexpMaxRegisterCount(data, (capture_count + 1) * 2);
+  SetIrregexpCaptureNameMap(data, capture_name_map);
+}
+
+int RegExpImpl::LinearExecRaw(Handle<JSRegExp> regexp, Handle<String> subject,
+                              int index, int32_t* output, int output_size) {
+  DCHECK_EQ(regexp->TypeTag(), JSRegExp::LINEAR);
+  DCHECK_LE(0, index);
+  DCHECK_LE(index, subject->length());
+  DCHECK(subject->IsFlat());
+
+  FixedArray* data = FixedArray::cast(regexp->data());
+  int register_count = IrregexpNumberOfRegisters(data);
+  DCHECK_GE(output_size, register_count);
+  ByteArray* program =
+      ByteArray::cast(data->get(JSRegExp::kIrregexpLatin1CodeIndex));
+  return RegExpLinear::Match(program, *subject, index,
+                             IsSticky(regexp->GetFlags()), output,
+                             register_count);
+}
+
+Handle<Object> RegExpImpl::LinearExec(Handle<JSRegExp> regexp,
+                                      Handle<String> subject, int index,
+                                      Handle<RegExpMatchInfo> last_match_info) {
+  Isolate* isolate = regexp->GetIsolate();
+  subject = String::Flatten(subject);
+
+  int register_count =
+      IrregexpNumberOfRegisters(FixedArray::cast(regexp->data()));
+  int32_t* output_registers = nullptr;
+  if (register_count > Isolate::kJSRegexpStaticOffsetsVectorSize) {
+    output_registers = NewArray<int32_t>(register_count);
+  }
+  std::unique_ptr<int32_t[]> auto_release(output_registers);
+  if (output_registers == nullptr) {
+    output_registers = isolate->jsregexp_static_offsets_vector();
+  }
+
+  int res = LinearExecRaw(regexp, subject, index, output_registers,
+                          register_count);
+  if (res == RE_FAILURE) return isolate->factory()->null_value();
+
+  DCHECK_EQ(res, RE_SUCCESS);
+  int capture_count =
+      IrregexpNumberOfCaptures(FixedArray::cast(regexp->data()));
+  return SetLastMatchInfo(last_match_info, subject, capture_count,
+                          output_registers);
+}
+
+
 // Irregexp implementation.
 
 // Ensures that the regexp object contains a compiled version of the
-// source for either one-byte or two-byte subject strings.
+// source for either one-byte or two-byte subject strings, as bytecode or
+// as native code.
 // If the compiled version doesn't already exist, it is compiled
 // from the source pattern.
 // If compilation fails, an exception is thrown and this function
 // returns false.
 bool RegExpImpl::EnsureCompiledIrregexp(Handle<JSRegExp> re,
                                         Handle<String> sample_subject,
-                                        bool is_one_byte) {
+                                        bool is_one_byte, bool use_bytecode) {
   Object* compiled_code = re->DataAt(JSRegExp::code_index(is_one_byte));
-#ifdef V8_INTERPRETED_REGEXP
-  if (compiled_code->IsByteArray()) return true;
-#else  // V8_INTERPRETED_REGEXP (RegExp native code)
-  if (compiled_code->IsCode()) return true;
-#endif
-  return CompileIrregexp(re, sample_subject, is_one_byte);
+  if (use_bytecode ? compiled_code->IsByteArray() : compiled_code->IsCode()) {
+    return true;
+  }
+  return CompileIrregexp(re, sample_subject, is_one_byte, use_bytecode);
 }
 
 
 bool RegExpImpl::CompileIrregexp(Handle<JSRegExp> re,
                                  Handle<String> sample_subject,
-                                 bool is_one_byte) {
+                                 bool is_one_byte, bool use_bytecode) {
   // Compile the RegExp.
   Isolate* isolate = re->GetIsolate();
   Zone zone(isolate->allocator(), ZONE_NAME);
   PostponeInterruptsScope postpone(isolate);
-#ifdef DEBUG
   Object* entry = re->DataAt(JSRegExp::code_index(is_one_byte));
   // When arriving here entry can only be a smi representing an uncompiled
-  // regexp.
-  DCHECK(entry->IsSmi());
-  int entry_value = Smi::ToInt(entry);
-  DCHECK_EQ(JSRegExp::kUninitializedValue, entry_value);
-#endif
+  // regexp, or bytecode that is replaced by native code on tier-up.
+  DCHECK(entry->IsSmi() || (!use_bytecode && entry->IsByteArray()));
+  DCHECK_IMPLIES(entry->IsSmi(),
+                 Smi::ToInt(entry) == JSRegExp::kUninitializedValue);
+  bool is_tier_up = entry->IsByteArray();
+
+  Counters* counters = isolate->counters();
+  HistogramTimerScope timer(use_bytecode ? counters->compile_regexp_bytecode()
+                                         : counters->compile_regexp_native());
 
   JSRegExp::Flags flags = re->GetFlags();
 
   Handle<String> pattern(re->Pattern());
   pattern = String::Flatten(pattern);
+
+  // Bytecode may have been compiled for the same pattern in another isolate
+  // already.
+  if (use_bytecode) {
+    Handle<ByteArray> bytecode;
+    int num_registers;
+    if (RegExpBytecodeCache::Lookup(isolate, pattern, flags, is_one_byte,
+                                    &num_registers)
+            .ToHandle(&bytecode)) {
+      counters->regexp_bytecode_cache_hits()->Increment();
+      FixedArray* data = FixedArray::cast(re->data());
+      data->set(JSRegExp::code_index(is_one_byte), *bytecode);
+      // Patterns with named captures are never cached.
+      SetIrregexpCaptureNameMap(data, Handle<FixedArray>::null());
+      if (num_registers > IrregexpMaxRegisterCount(data)) {
+        SetIrregexpMaxRegisterCount(data, num_registers);
+      }
+      return true;
+    }
+  }
+
   RegExpCompileData compile_data;
   FlatStringReader reader(isolate, pattern);
   if (!RegExpParser::ParseRegExp(isolate, &zone, &reader, flags,
@@ -350,7 +581,7 @@ bool RegExpImpl::CompileIrregexp(Handle<JSRegExp> re,
   }
   RegExpEngine::CompilationResult result =
       RegExpEngine::Compile(isolate, &zone, &compile_data, flags, pattern,
-                            sample_subject, is_one_byte);
+                            sample_subject, is_one_byte, use_bytecode);
   if (result.error_message != nullptr) {
     // Unable to compile regexp.
     if (FLAG_abort_on_stack_or_string_length_overflow &&
@@ -363,6 +594,23 @@ bool RegExpImpl::CompileIrregexp(Handle<JSRegExp> re,
     return false;
   }
 
+  int code_size = HeapObject::cast(result.code)->Size();
+  if (use_bytecode) {
+    counters->regexp_bytecode_compiled()->Increment();
+    counters->regexp_bytecode_size()->Increment(code_size);
+    // Patterns with named captures need the capture name map, which is only
+    // built by parsing the pattern, so they are not shared.
+    if (compile_data.capture_name_map.is_null()) {
+      RegExpBytecodeCache::Insert(pattern, flags, is_one_byte,
+                                  ByteArray::cast(result.code),
+                                  result.num_registers);
+    }
+  } else {
+    counters->regexp_native_compiled()->Increment();
+    counters->regexp_native_code_size()->Increment(code_size);
+    if (is_tier_up) counters->regexp_tier_ups()->Increment();
+  }
+
   Handle<FixedArray> data = Handle<FixedArray>(FixedArray::cast(re->data()));
   data->set(JSRegExp::code_index(is_one_byte), result.code);
   SetIrregexpCaptureNameMap(*data, compile_data.capture_name_map);
@@ -414,6 +662,39 @@ Code* RegExpImpl::IrregexpNativeCode(FixedArray* re, bool is_one_byte) {
 }
 
 
+void RegExpImpl::SetIrregexpRequiredLiteral(Handle<JSRegExp> re,
+                                            Handle<String> literal,
+                                            int min_offset, int max_offset) {
+  DCHECK_EQ(JSRegExp::IRREGEXP, re->TypeTag());
+  DCHECK(literal->IsSeqString());
+  DCHECK_LE(min_offset, max_offset);
+  if (max_offset > String::kMaxLength) max_offset = -1;
+  re->SetDataAt(JSRegExp::kIrregexpRequiredLiteralIndex, *literal);
+  re->SetDataAt(JSRegExp::kIrregexpRequiredLiteralMinOffsetIndex,
+                Smi::FromInt(min_offset));
+  re->SetDataAt(JSRegExp::kIrregexpRequiredLiteralMaxOffsetIndex,
+                Smi::FromInt(max_offset));
+}
+
+bool RegExpImpl::IrregexpSkipToRequiredLiteral(Handle<JSRegExp> regexp,
+                                               Handle<String> subject,
+                                               int* index) {
+  Object* literal = regexp->DataAt(JSRegExp::kIrregexpRequiredLiteralIndex);
+  if (literal->IsSmi()) return true;
+  int min_offset = Smi::ToInt(
+      regexp->DataAt(JSRegExp::kIrregexpRequiredLiteralMinOffsetIndex));
+  int max_offset = Smi::ToInt(
+      regexp->DataAt(JSRegExp::kIrregexpRequiredLiteralMaxOffsetIndex));
+  if (min_offset > subject->length() - *index) return false;
+  Isolate* isolate = regexp->GetIsolate();
+  int found = String::IndexOf(isolate, subject,
+                              handle(String::cast(literal), isolate),
+                              *index + min_offset);
+  if (found < 0) return false;
+  if (max_offset >= 0) *index = Max(*index, found - max_offset);
+  return true;
+}
+
 void RegExpImpl::IrregexpInitialize(Handle<JSRegExp> re,
                                     Handle<String> pattern,
                                     JSRegExp::Flags flags,
@@ -431,22 +712,31 @@ int RegExpImpl::IrregexpPrepare(Handle<JSRegExp> regexp,
                                 Handle<String> subject) {
   DCHECK(subject->IsFlat());
 
+  // The interpreter is much slower than native code, which pays off quickly
+  // on long subjects.
+  if (subject->length() >= JSRegExp::kTierUpForSubjectLength &&
+      regexp->ShouldProduceBytecode()) {
+    regexp->MarkTierUpForNextExec();
+  }
+
   // Check representation of the underlying storage.
   bool is_one_byte = subject->IsOneByteRepresentationUnderneath();
-  if (!EnsureCompiledIrregexp(regexp, subject, is_one_byte)) return -1;
+  bool use_bytecode = regexp->ShouldProduceBytecode();
+  if (!EnsureCompiledIrregexp(regexp, subject, is_one_byte, use_bytecode)) {
+    return -1;
+  }
 
-#ifdef V8_INTERPRETED_REGEXP
-  // Byte-code regexp needs space allocated for all its registers.
-  // The result captures are copied to the start of the registers array
-  // if the match succeeds.  This way those registers are not clobbered
-  // when we set the last match info from last successful match.
-  return IrregexpNumberOfRegisters(FixedArray::cast(regexp->data())) +
-         (IrregexpNumberOfCaptures(FixedArray::cast(regexp->data())) + 1) * 2;
-#else  // V8_INTERPRETED_REGEXP
+  if (use_bytecode) {
+    // Byte-code regexp needs space allocated for all its registers.
+    // The result captures are copied to the start of the registers array
+    // if the match succeeds.  This way those registers are not clobbered
+    // when we set the last match info from last successful match.
+    return IrregexpNumberOfRegisters(FixedArray::cast(regexp->data())) +
+           (IrregexpNumberOfCaptures(FixedArray::cast(regexp->data())) + 1) * 2;
+  }
   // Native regexp only needs room to output captures. Registers are handled
   // internally.
   return (IrregexpNumberOfCaptures(FixedArray::cast(regexp->data())) + 1) * 2;
-#endif  // V8_INTERPRETED_REGEXP
 }
 
 
@@ -454,21 +744,34 @@ int RegExpImpl::IrregexpExecRaw(Handle<JSRegExp> regexp,
                                 Handle<String> subject,
                                 int index,
                                 int32_t* output,
-                                int output_size) {
-  Isolate* isolate = regexp->GetIsolate();
-
-  Handle<FixedArray> irregexp(FixedArray::cast(regexp->data()), isolate);
-
+                                int output_size,
+                                bool use_bytecode) {
   DCHECK_LE(0, index);
   DCHECK_LE(index, subject->length());
   DCHECK(subject->IsFlat());
 
-  bool is_one_byte = subject->IsOneByteRepresentationUnderneath();
+  if (!IrregexpSkipToRequiredLiteral(regexp, subject, &index)) {
+    return RE_FAILURE;
+  }
 
-#ifndef V8_INTERPRETED_REGEXP
+  if (use_bytecode) {
+    return IrregexpExecBytecode(regexp, subject, index, output, output_size);
+  }
+  return IrregexpExecNative(regexp, subject, index, output, output_size);
+}
+
+int RegExpImpl::IrregexpExecNative(Handle<JSRegExp> regexp,
+                                   Handle<String> subject, int index,
+                                   int32_t* output, int output_size) {
+#ifdef V8_INTERPRETED_REGEXP
+  UNREACHABLE();
+#else  // V8_INTERPRETED_REGEXP
+  Isolate* isolate = regexp->GetIsolate();
+  Handle<FixedArray> irregexp(FixedArray::cast(regexp->data()), isolate);
+  bool is_one_byte = subject->IsOneByteRepresentationUnderneath();
   DCHECK(output_size >= (IrregexpNumberOfCaptures(*irregexp) + 1) * 2);
   do {
-    EnsureCompiledIrregexp(regexp, subject, is_one_byte);
+    EnsureCompiledIrregexp(regexp, subject, is_one_byte, false);
     Handle<Code> code(IrregexpNativeCode(*irregexp, is_one_byte), isolate);
     // The stack is used to allocate registers for the compiled regexp code.
     // This means that in case of failure, the output registers array is left
@@ -502,38 +805,77 @@ int RegExpImpl::IrregexpExecRaw(Handle<JSRegExp> regexp,
     is_one_byte = subject->IsOneByteRepresentationUnderneath();
   } while (true);
   UNREACHABLE();
-#else  // V8_INTERPRETED_REGEXP
+#endif  // V8_INTERPRETED_REGEXP
+}
 
+int RegExpImpl::IrregexpExecBytecode(Handle<JSRegExp> regexp,
+                                     Handle<String> subject, int index,
+                                     int32_t* output, int output_size) {
+  Isolate* isolate = regexp->GetIsolate();
+  Handle<FixedArray> irregexp(FixedArray::cast(regexp->data()), isolate);
+  bool is_one_byte = subject->IsOneByteRepresentationUnderneath();
   DCHECK(output_size >= IrregexpNumberOfRegisters(*irregexp));
   // We must have done EnsureCompiledIrregexp, so we can get the number of
   // registers.
   int number_of_capture_registers =
       (IrregexpNumberOfCaptures(*irregexp) + 1) * 2;
   int32_t* raw_output = &output[number_of_capture_registers];
-  // We do not touch the actual capture result registers until we know there
-  // has been a match so that we can use those capture results to set the
-  // last match info.
-  for (int i = number_of_capture_registers - 1; i >= 0; i--) {
-    raw_output[i] = -1;
-  }
-  Handle<ByteArray> byte_codes(IrregexpByteCode(*irregexp, is_one_byte),
-                               isolate);
-
-  IrregexpResult result = IrregexpInterpreter::Match(isolate,
-                                                     byte_codes,
-                                                     subject,
-                                                     raw_output,
-                                                     index);
-  if (result == RE_SUCCESS) {
+  IrregexpInterpreter::Result result;
+  do {
+#ifndef V8_INTERPRETED_REGEXP
+    // The regexp may have tiered up since IrregexpPrepare, e.g. in a nested
+    // call, or the subject may have changed representation. There is no
+    // going back from native code, which only needs room for the captures
+    // of a single match at the start of {output}.
+    if (irregexp->get(JSRegExp::code_index(is_one_byte))->IsCode()) {
+      return IrregexpExecNative(regexp, subject, index, output,
+                                number_of_capture_registers);
+    }
+#endif  // V8_INTERPRETED_REGEXP
+    if (!EnsureCompiledIrregexp(regexp, subject, is_one_byte, true)) {
+      return RE_EXCEPTION;
+    }
+    // We do not touch the actual capture result registers until we know
+    // there has been a match so that we can use those capture results to set
+    // the last match info.
+    for (int i = number_of_capture_registers - 1; i >= 0; i--) {
+      raw_output[i] = -1;
+    }
+    Handle<ByteArray> byte_codes(IrregexpByteCode(*irregexp, is_one_byte),
+                                 isolate);
+    result = IrregexpInterpreter::Match(isolate, byte_codes, subject,
+                                        raw_output, index);
+    if (result != IrregexpInterpreter::RETRY) break;
+    // The subject changed representation while an interrupt was handled, so
+    // start over with the code for the new one, like IrregexpExecNative does.
+    is_one_byte = subject->IsOneByteRepresentationUnderneath();
+  } while (true);
+  regexp->TierUpTick();
+  if (result == IrregexpInterpreter::SUCCESS) {
     // Copy capture results to the start of the registers array.
     MemCopy(output, raw_output, number_of_capture_registers * sizeof(int32_t));
   }
-  if (result == RE_EXCEPTION) {
-    DCHECK(!isolate->has_pending_exception());
+  if (result == IrregexpInterpreter::EXCEPTION) {
+    // An interrupt that terminated execution or threw leaves an exception
+    // pending. Otherwise the backtrack stack overflowed.
+    if (isolate->has_pending_exception()) return RE_EXCEPTION;
+#ifndef V8_INTERPRETED_REGEXP
+    if (FLAG_regexp_tier_up) {
+      // The backtrack stack of the interpreter is much smaller than the one
+      // of native code. Rather than failing, tier up and match again. Only
+      // room for a single match is passed, like the interpreter would find.
+      regexp->MarkTierUpForNextExec();
+      return IrregexpExecNative(regexp, subject, index, output,
+                                number_of_capture_registers);
+    }
+#endif  // V8_INTERPRETED_REGEXP
     isolate->StackOverflow();
   }
-  return result;
-#endif  // V8_INTERPRETED_REGEXP
+  STATIC_ASSERT(static_cast<int>(IrregexpInterpreter::SUCCESS) == RE_SUCCESS);
+  STATIC_ASSERT(static_cast<int>(IrregexpInterpreter::FAILURE) == RE_FAILURE);
+  STATIC_ASSERT(static_cast<int>(IrregexpInterpreter::EXCEPTION) ==
+                RE_EXCEPTION);
+  return static_cast<IrregexpResult>(result);
 }
 
 MaybeHandle<Object> RegExpImpl::IrregexpExec(
@@ -545,8 +887,8 @@ MaybeHandle<Object> RegExpImpl::IrregexpExec(
   subject = String::Flatten(subject);
 
   // Prepare space for the return values.
-#if defined(V8_INTERPRETED_REGEXP) && defined(DEBUG)
-  if (FLAG_trace_regexp_bytecodes) {
+#ifdef DEBUG
+  if (FLAG_trace_regexp_bytecodes && regexp->ShouldProduceBytecode()) {
     String* pattern = regexp->Pattern();
     PrintF("\n\nRegexp match:   /%s/\n\n", pattern->ToCString().get());
     PrintF("\n\nSubject string: '%s'\n\n", subject->ToCString().get());
@@ -558,6 +900,8 @@ MaybeHandle<Object> RegExpImpl::IrregexpExec(
     DCHECK(isolate->has_pending_exception());
     return MaybeHandle<Object>();
   }
+  // The layout of the output registers depends on the kind of code chosen.
+  bool use_bytecode = regexp->ShouldProduceBytecode();
 
   int32_t* output_registers = nullptr;
   if (required_registers > Isolate::kJSRegexpStaticOffsetsVectorSize) {
@@ -568,8 +912,9 @@ MaybeHandle<Object> RegExpImpl::IrregexpExec(
     output_registers = isolate->jsregexp_static_offsets_vector();
   }
 
-  int res = RegExpImpl::IrregexpExecRaw(
-      regexp, subject, previous_index, output_registers, required_registers);
+  int res = RegExpImpl::IrregexpExecRaw(regexp, subject, previous_index,
+                                        output_registers, required_registers,
+                                        use_bytecode);
   if (res == RE_SUCCESS) {
     int capture_count =
         IrregexpNumberOfCaptures(FixedArray::cast(regexp->data()));
@@ -624,25 +969,31 @@ RegExpImpl::GlobalCache::GlobalCache(Handle<JSRegExp> regexp,
                                      Handle<String> subject, Isolate* isolate)
     : register_array_(nullptr),
       register_array_size_(0),
+      use_bytecode_(false),
       regexp_(regexp),
       subject_(subject) {
-#ifdef V8_INTERPRETED_REGEXP
-  bool interpreted = true;
-#else
   bool interpreted = false;
-#endif  // V8_INTERPRETED_REGEXP
 
   if (regexp_->TypeTag() == JSRegExp::ATOM) {
     static const int kAtomRegistersPerMatch = 2;
     registers_per_match_ = kAtomRegistersPerMatch;
     // There is no distinction between interpreted and native for atom regexps.
     interpreted = false;
+  } else if (regexp_->TypeTag() == JSRegExp::LINEAR) {
+    registers_per_match_ =
+        IrregexpNumberOfRegisters(FixedArray::cast(regexp_->data()));
+    // Like the interpreter, the linear-time engine finds one match at a time.
+    interpreted = true;
   } else {
     registers_per_match_ = RegExpImpl::IrregexpPrepare(regexp_, subject_);
     if (registers_per_match_ < 0) {
       num_matches_ = -1;  // Signal exception.
       return;
     }
+    // The kind of code is fixed for the life time of the cache, since the
+    // layout of the registers depends on it.
+    use_bytecode_ = regexp_->ShouldProduceBytecode();
+    interpreted = use_bytecode_;
   }
 
   DCHECK(IsGlobal(regexp->GetFlags()));
@@ -1107,7 +1458,7 @@ RegExpEngine::CompilationResult RegExpCompiler::Assemble(
   isolate->IncreaseTotalRegexpCodeGenerated(code->Size());
   work_list_ = nullptr;
 #if defined(ENABLE_DISASSEMBLER) && !defined(V8_INTERPRETED_REGEXP)
-  if (FLAG_print_code) {
+  if (FLAG_print_code && code->IsCode()) {
     CodeTracer::Scope trace_scope(isolate->GetCodeTracer());
     OFStream os(trace_scope.file());
     Handle<Code>::cast(code)->Disassemble(pattern->ToCString().get(), os);
@@ -6655,7 +7006,7 @@ RegExpNode* OptionallyStepBackToLeadSurrogate(RegExpCompiler* compiler,
 RegExpEngine::CompilationResult RegExpEngine::Compile(
     Isolate* isolate, Zone* zone, RegExpCompileData* data,
     JSRegExp::Flags flags, Handle<String> pattern,
-    Handle<String> sample_subject, bool is_one_byte) {
+    Handle<String> sample_subject, bool is_one_byte, bool use_bytecode) {
   if ((data->capture_count + 1) * 2 - 1 > RegExpMacroAssembler::kMaxRegister) {
     return IrregexpRegExpTooBig(isolate);
   }
@@ -6729,56 +7080,61 @@ RegExpEngine::CompilationResult RegExpEngine::Compile(
     return CompilationResult(isolate, error_message);
   }
 
-  // Create the correct assembler for the architecture.
+  // Create the correct assembler for the architecture, or for bytecode.
+  EmbeddedVector<byte, 1024> codes;
+  std::unique_ptr<RegExpMacroAssembler> macro_assembler;
+  if (use_bytecode) {
+    macro_assembler.reset(
+        new RegExpMacroAssemblerIrregexp(isolate, codes, zone));
+  } else {
 #ifndef V8_INTERPRETED_REGEXP
-  // Native regexp implementation.
-
-  NativeRegExpMacroAssembler::Mode mode =
-      is_one_byte ? NativeRegExpMacroAssembler::LATIN1
-                  : NativeRegExpMacroAssembler::UC16;
+    // Native regexp implementation.
+    NativeRegExpMacroAssembler::Mode mode =
+        is_one_byte ? NativeRegExpMacroAssembler::LATIN1
+                    : NativeRegExpMacroAssembler::UC16;
+    int output_registers = (data->capture_count + 1) * 2;
 
 #if V8_TARGET_ARCH_IA32
-  RegExpMacroAssemblerIA32 macro_assembler(isolate, zone, mode,
-                                           (data->capture_count + 1) * 2);
+    macro_assembler.reset(
+        new RegExpMacroAssemblerIA32(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_X64
-  RegExpMacroAssemblerX64 macro_assembler(isolate, zone, mode,
-                                          (data->capture_count + 1) * 2);
+    macro_assembler.reset(
+        new RegExpMacroAssemblerX64(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_ARM
-  RegExpMacroAssemblerARM macro_assembler(isolate, zone, mode,
-                                          (data->capture_count + 1) * 2);
+    macro_assembler.reset(
+        new RegExpMacroAssemblerARM(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_ARM64
-  RegExpMacroAssemblerARM64 macro_assembler(isolate, zone, mode,
-                                            (data->capture_count + 1) * 2);
+    macro_assembler.reset(
+        new RegExpMacroAssemblerARM64(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_S390
-  RegExpMacroAssemblerS390 macro_assembler(isolate, zone, mode,
-                                           (data->capture_count + 1) * 2);
+    macro_assembler.reset(
+        new RegExpMacroAssemblerS390(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_PPC
-  RegExpMacroAssemblerPPC macro_assembler(isolate, zone, mode,
-                                          (data->capture_count + 1) * 2);
+    macro_assembler.reset(
+        new RegExpMacroAssemblerPPC(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_MIPS
-  RegExpMacroAssemblerMIPS macro_assembler(isolate, zone, mode,
-                                           (data->capture_count + 1) * 2);
+    macro_assembler.reset(
+        new RegExpMacroAssemblerMIPS(isolate, zone, mode, output_registers));
 #elif V8_TARGET_ARCH_MIPS64
-  RegExpMacroAssemblerMIPS macro_assembler(isolate, zone, mode,
-                                           (data->capture_count + 1) * 2);
+    macro_assembler.reset(
+        new RegExpMacroAssemblerMIPS(isolate, zone, mode, output_registers));
 #else
 #error "Unsupported architecture"
 #endif
 
 #else  // V8_INTERPRETED_REGEXP
-  // Interpreted regexp implementation.
-  EmbeddedVector<byte, 1024> codes;
-  RegExpMacroAssemblerIrregexp macro_assembler(isolate, codes, zone);
+    UNREACHABLE();
 #endif  // V8_INTERPRETED_REGEXP
+  }
 
-  macro_assembler.set_slow_safe(TooMuchRegExpCode(pattern));
+  macro_assembler->set_slow_safe(TooMuchRegExpCode(pattern));
 
   // Inserted here, instead of in Assembler, because it depends on information
   // in the AST that isn't replicated in the Node structure.
   static const int kMaxBacksearchLimit = 1024;
   if (is_end_anchored && !is_start_anchored && !is_sticky &&
       max_length < kMaxBacksearchLimit) {
-    macro_assembler.SetCurrentPositionFromEnd(max_length);
+    macro_assembler->SetCurrentPositionFromEnd(max_length);
   }
 
   if (is_global) {
@@ -6788,10 +7144,10 @@ RegExpEngine::CompilationResult RegExpEngine::Compile(
     } else if (is_unicode) {
       mode = RegExpMacroAssembler::GLOBAL_UNICODE;
     }
-    macro_assembler.set_global_mode(mode);
+    macro_assembler->set_global_mode(mode);
   }
 
-  return compiler.Assemble(&macro_assembler,
+  return compiler.Assemble(macro_assembler.get(),
                            node,
                            data->capture_count,
                            pattern);
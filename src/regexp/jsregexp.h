@@ -107,10 +107,28 @@ class RegExpImpl {
 
   enum IrregexpResult { RE_FAILURE = 0, RE_SUCCESS = 1, RE_EXCEPTION = -1 };
 
+  // Prepares a JSRegExp object for the linear-time engine, with the program
+  // compiled by RegExpLinear::Compile.
+  static void LinearInitialize(Handle<JSRegExp> re, Handle<String> pattern,
+                               JSRegExp::Flags flags, int capture_count,
+                               Handle<FixedArray> capture_name_map,
+                               Handle<ByteArray> program);
+
+  // Like IrregexpExecRaw, for a regexp matched by the linear-time engine.
+  // Finds at most one match and never throws.
+  static int LinearExecRaw(Handle<JSRegExp> regexp, Handle<String> subject,
+                           int index, int32_t* output, int output_size);
+
+  static Handle<Object> LinearExec(Handle<JSRegExp> regexp,
+                                   Handle<String> subject, int index,
+                                   Handle<RegExpMatchInfo> last_match_info);
+
   // Prepare a RegExp for being executed one or more times (using
   // IrregexpExecOnce) on the subject.
   // This ensures that the regexp is compiled for the subject, and that
   // the subject is flat.
+  // Also decides whether the regexp is run by the bytecode interpreter or
+  // tiers up to native code, see JSRegExp::ShouldProduceBytecode.
   // Returns the number of integer spaces required by IrregexpExecOnce
   // as its "registers" argument.  If the regexp cannot be compiled,
   // an exception is set as pending, and this function returns negative.
@@ -123,11 +141,14 @@ class RegExpImpl {
   // The captures and subcaptures are stored into the registers vector.
   // If matching fails, returns RE_FAILURE.
   // If execution fails, sets a pending exception and returns RE_EXCEPTION.
+  // {use_bytecode} must be the kind of code IrregexpPrepare chose, i.e. the
+  // value of JSRegExp::ShouldProduceBytecode right after it returned.
   static int IrregexpExecRaw(Handle<JSRegExp> regexp,
                              Handle<String> subject,
                              int index,
                              int32_t* output,
-                             int output_size);
+                             int output_size,
+                             bool use_bytecode);
 
   // Execute an Irregexp bytecode pattern.
   // On a successful match, the result is a JSArray containing
@@ -171,6 +192,7 @@ class RegExpImpl {
     // Pointer to the last set of captures.
     int32_t* register_array_;
     int register_array_size_;
+    bool use_bytecode_;
     Handle<JSRegExp> regexp_;
     Handle<String> subject_;
   };
@@ -196,10 +218,30 @@ class RegExpImpl {
 
  private:
   static bool CompileIrregexp(Handle<JSRegExp> re,
-                              Handle<String> sample_subject, bool is_one_byte);
+                              Handle<String> sample_subject, bool is_one_byte,
+                              bool use_bytecode);
   static inline bool EnsureCompiledIrregexp(Handle<JSRegExp> re,
                                             Handle<String> sample_subject,
-                                            bool is_one_byte);
+                                            bool is_one_byte,
+                                            bool use_bytecode);
+  // Helpers of IrregexpExecRaw for the two kinds of code.
+  static int IrregexpExecNative(Handle<JSRegExp> regexp,
+                                Handle<String> subject, int index,
+                                int32_t* output, int output_size);
+  static int IrregexpExecBytecode(Handle<JSRegExp> regexp,
+                                  Handle<String> subject, int index,
+                                  int32_t* output, int output_size);
+
+  static void SetIrregexpRequiredLiteral(Handle<JSRegExp> re,
+                                         Handle<String> literal,
+                                         int min_offset, int max_offset);
+  // Moves {index} ahead to the first position at which a match can start,
+  // judging by the literal that every match contains. Returns false if the
+  // literal does not occur where a match starting at or after {index} would
+  // contain it.
+  static bool IrregexpSkipToRequiredLiteral(Handle<JSRegExp> regexp,
+                                            Handle<String> subject,
+                                            int* index);
 };
 
 
@@ -1534,7 +1576,7 @@ class RegExpEngine: public AllStatic {
                                    JSRegExp::Flags flags,
                                    Handle<String> pattern,
                                    Handle<String> sample_subject,
-                                   bool is_one_byte);
+                                   bool is_one_byte, bool use_bytecode);
 
   static bool TooMuchRegExpCode(Handle<String> pattern);
 
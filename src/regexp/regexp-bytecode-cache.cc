@@ -0,0 +1,146 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-bytecode-cache.h"
+
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
+#include "src/factory.h"
+#include "src/flags.h"
+#include "src/objects-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+struct CacheEntry {
+  std::vector<byte> bytecode;
+  int num_registers;
+};
+
+// The keys of the entries, most recently used first. They point into the
+// table, whose elements stay in place when it grows.
+typedef std::list<const std::string*> RecencyList;
+
+struct CacheSlot {
+  // Entries are never changed once inserted, so lookups can copy the bytecode
+  // out without holding the lock.
+  std::shared_ptr<const CacheEntry> entry;
+  RecencyList::iterator recency;
+};
+
+typedef std::unordered_map<std::string, CacheSlot> CacheTable;
+
+struct Cache {
+  CacheTable table;
+  RecencyList recency;
+  size_t size = 0;
+};
+
+size_t EntrySize(const std::string& key, const CacheEntry& entry) {
+  return key.size() + entry.bytecode.size();
+}
+
+base::LazyMutex cache_mutex = LAZY_MUTEX_INITIALIZER;
+base::LazyInstance<Cache>::type cache = LAZY_INSTANCE_INITIALIZER;
+
+// The key consists of the flags, the subject encoding and the characters of
+// the pattern. The pattern's own encoding is part of it as well, so that the
+// characters can be copied as they are.
+std::string CacheKey(Handle<String> pattern, JSRegExp::Flags flags,
+                     bool is_one_byte) {
+  DisallowHeapAllocation no_gc;
+  String::FlatContent content = pattern->GetFlatContent();
+  DCHECK(content.IsFlat());
+  std::string key;
+  key.push_back(static_cast<char>(static_cast<int>(flags)));
+  key.push_back(is_one_byte ? 1 : 0);
+  key.push_back(content.IsOneByte() ? 1 : 0);
+  if (content.IsOneByte()) {
+    Vector<const uint8_t> chars = content.ToOneByteVector();
+    key.append(reinterpret_cast<const char*>(chars.start()), chars.length());
+  } else {
+    Vector<const uc16> chars = content.ToUC16Vector();
+    key.append(reinterpret_cast<const char*>(chars.start()),
+               chars.length() * sizeof(uc16));
+  }
+  return key;
+}
+
+}  // namespace
+
+MaybeHandle<ByteArray> RegExpBytecodeCache::Lookup(Isolate* isolate,
+                                                   Handle<String> pattern,
+                                                   JSRegExp::Flags flags,
+                                                   bool is_one_byte,
+                                                   int* num_registers) {
+  if (FLAG_regexp_bytecode_cache_size == 0) return MaybeHandle<ByteArray>();
+  std::string key = CacheKey(pattern, flags, is_one_byte);
+  std::shared_ptr<const CacheEntry> entry;
+  {
+    base::LockGuard<base::Mutex> lock_guard(cache_mutex.Pointer());
+    Cache* cache_ptr = cache.Pointer();
+    CacheTable::iterator it = cache_ptr->table.find(key);
+    if (it == cache_ptr->table.end()) return MaybeHandle<ByteArray>();
+    entry = it->second.entry;
+    cache_ptr->recency.splice(cache_ptr->recency.begin(), cache_ptr->recency,
+                              it->second.recency);
+  }
+  int length = static_cast<int>(entry->bytecode.size());
+  Handle<ByteArray> bytecode =
+      isolate->factory()->NewByteArray(length, TENURED);
+  bytecode->copy_in(0, entry->bytecode.data(), length);
+  *num_registers = entry->num_registers;
+  return bytecode;
+}
+
+void RegExpBytecodeCache::Insert(Handle<String> pattern, JSRegExp::Flags flags,
+                                 bool is_one_byte, ByteArray* bytecode,
+                                 int num_registers) {
+  size_t max_size = static_cast<size_t>(FLAG_regexp_bytecode_cache_size) * KB;
+  size_t length = static_cast<size_t>(bytecode->length());
+  std::string key = CacheKey(pattern, flags, is_one_byte);
+
+  std::shared_ptr<CacheEntry> entry = std::make_shared<CacheEntry>();
+  entry->bytecode.assign(bytecode->GetDataStartAddress(),
+                         bytecode->GetDataStartAddress() + length);
+  entry->num_registers = num_registers;
+  size_t entry_size = EntrySize(key, *entry);
+  if (entry_size > max_size) return;
+
+  base::LockGuard<base::Mutex> lock_guard(cache_mutex.Pointer());
+  Cache* cache_ptr = cache.Pointer();
+  if (cache_ptr->table.count(key) != 0) return;
+  // Evict the least recently used entries until the new one fits.
+  while (cache_ptr->size + entry_size > max_size) {
+    CacheTable::iterator victim =
+        cache_ptr->table.find(*cache_ptr->recency.back());
+    cache_ptr->size -= EntrySize(victim->first, *victim->second.entry);
+    cache_ptr->recency.pop_back();
+    cache_ptr->table.erase(victim);
+  }
+  CacheTable::iterator it =
+      cache_ptr->table.emplace(std::move(key), CacheSlot()).first;
+  cache_ptr->recency.push_front(&it->first);
+  it->second.entry = std::move(entry);
+  it->second.recency = cache_ptr->recency.begin();
+  cache_ptr->size += entry_size;
+}
+
+void RegExpBytecodeCache::Clear() {
+  base::LockGuard<base::Mutex> lock_guard(cache_mutex.Pointer());
+  cache.Pointer()->table.clear();
+  cache.Pointer()->recency.clear();
+  cache.Pointer()->size = 0;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,43 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+#define V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+
+#include "src/objects/js-regexp.h"
+
+namespace v8 {
+namespace internal {
+
+// A process-wide cache of irregexp bytecode, keyed by the source and flags of
+// the pattern. Unlike native code, bytecode does not refer to anything in the
+// heap it was compiled in, so any isolate of the process can copy it into a
+// ByteArray of its own instead of parsing and compiling the pattern again.
+// This makes regexps that are used in many isolates (e.g. in workers) cheap
+// to compile after the first isolate has compiled them.
+class RegExpBytecodeCache : public AllStatic {
+ public:
+  // Returns a copy of the bytecode compiled for the flat {pattern} with
+  // {flags} for subjects of the given encoding, and sets {num_registers} to
+  // the number of registers it uses. Returns an empty handle if there is no
+  // such bytecode in the cache.
+  static MaybeHandle<ByteArray> Lookup(Isolate* isolate,
+                                       Handle<String> pattern,
+                                       JSRegExp::Flags flags, bool is_one_byte,
+                                       int* num_registers);
+
+  // Adds the {bytecode} compiled for the flat {pattern} to the cache. Evicts
+  // the least recently looked up or inserted bytecode to stay within
+  // --regexp-bytecode-cache-size.
+  static void Insert(Handle<String> pattern, JSRegExp::Flags flags,
+                     bool is_one_byte, ByteArray* bytecode, int num_registers);
+
+  // Drops all cached bytecode.
+  static void Clear();
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
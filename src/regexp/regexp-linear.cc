@@ -0,0 +1,496 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-linear.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "src/char-predicates-inl.h"
+#include "src/factory.h"
+#include "src/objects-inl.h"
+#include "src/regexp/regexp-ast.h"
+#include "src/unicode.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Instructions of the linear-time engine. Threads block on the CONSUME_*
+// instructions until the next subject character is available; all other
+// instructions are followed immediately.
+struct Instruction {
+  enum Opcode : int32_t {
+    // Consume one character in [first, second].
+    CONSUME_RANGE,
+    // Consume one character in any of the {first} RANGE entries that follow.
+    CONSUME_ANY_OF,
+    // Operand of CONSUME_ANY_OF, never executed on its own.
+    RANGE,
+    // Continue both at the next instruction and, with lower priority, at
+    // {first}.
+    FORK,
+    // Continue at {first}.
+    JUMP,
+    // Set register {first} to the current position.
+    SET_REGISTER,
+    // Reset registers {first} to {second} (inclusive) to -1.
+    CLEAR_REGISTERS,
+    // Fail unless the RegExpAssertion::AssertionType {first} holds.
+    ASSERTION,
+    // Report a match.
+    ACCEPT
+  };
+
+  int32_t opcode;
+  int32_t first;
+  int32_t second;
+};
+
+class LinearCompiler final : public RegExpVisitor {
+ public:
+  explicit LinearCompiler(Zone* zone)
+      : zone_(zone),
+        code_(16, zone),
+        ok_(true),
+        unbounded_depth_(0),
+        has_nested_quantifiers_(false) {}
+
+  ZoneList<Instruction>* code() { return &code_; }
+  bool ok() const { return ok_; }
+  bool has_nested_quantifiers() const { return has_nested_quantifiers_; }
+
+  int Emit(int32_t opcode, int32_t first = 0, int32_t second = 0) {
+    if (code_.length() >= RegExpLinear::kMaxProgramLength) ok_ = false;
+    if (!ok_) return 0;
+    code_.Add({opcode, first, second}, zone_);
+    return code_.length() - 1;
+  }
+
+  void* VisitDisjunction(RegExpDisjunction* node, void*) override {
+    ZoneList<RegExpTree*>* alternatives = node->alternatives();
+    ZoneList<int> jumps(alternatives->length(), zone_);
+    for (int i = 0; i < alternatives->length() && ok_; i++) {
+      bool is_last = i == alternatives->length() - 1;
+      int fork = is_last ? 0 : Emit(Instruction::FORK);
+      alternatives->at(i)->Accept(this, nullptr);
+      if (!is_last) {
+        jumps.Add(Emit(Instruction::JUMP), zone_);
+        Bind(fork);
+      }
+    }
+    for (int i = 0; i < jumps.length(); i++) Bind(jumps[i]);
+    return nullptr;
+  }
+
+  void* VisitAlternative(RegExpAlternative* node, void*) override {
+    ZoneList<RegExpTree*>* nodes = node->nodes();
+    for (int i = 0; i < nodes->length() && ok_; i++) {
+      nodes->at(i)->Accept(this, nullptr);
+    }
+    return nullptr;
+  }
+
+  void* VisitAssertion(RegExpAssertion* node, void*) override {
+    Emit(Instruction::ASSERTION, node->assertion_type());
+    return nullptr;
+  }
+
+  void* VisitCharacterClass(RegExpCharacterClass* node, void*) override {
+    if (IgnoreCase(node->flags()) || IsUnicode(node->flags())) {
+      ok_ = false;
+      return nullptr;
+    }
+    ZoneList<CharacterRange>* ranges = new (zone_)
+        ZoneList<CharacterRange>(node->ranges(zone_)->length(), zone_);
+    ranges->AddAll(*node->ranges(zone_), zone_);
+    CharacterRange::Canonicalize(ranges);
+    if (node->is_negated()) {
+      ZoneList<CharacterRange>* negated =
+          new (zone_) ZoneList<CharacterRange>(ranges->length() + 1, zone_);
+      CharacterRange::Negate(ranges, negated, zone_);
+      ranges = negated;
+    }
+    if (ranges->length() == 1) {
+      Emit(Instruction::CONSUME_RANGE, ranges->at(0).from(),
+           ranges->at(0).to());
+      return nullptr;
+    }
+    Emit(Instruction::CONSUME_ANY_OF, ranges->length());
+    for (int i = 0; i < ranges->length(); i++) {
+      Emit(Instruction::RANGE, ranges->at(i).from(), ranges->at(i).to());
+    }
+    return nullptr;
+  }
+
+  void* VisitAtom(RegExpAtom* node, void*) override {
+    if (node->ignore_case() || IsUnicode(node->flags())) {
+      ok_ = false;
+      return nullptr;
+    }
+    Vector<const uc16> data = node->data();
+    for (int i = 0; i < data.length(); i++) {
+      Emit(Instruction::CONSUME_RANGE, data[i], data[i]);
+    }
+    return nullptr;
+  }
+
+  void* VisitText(RegExpText* node, void*) override {
+    ZoneList<TextElement>* elements = node->elements();
+    for (int i = 0; i < elements->length() && ok_; i++) {
+      elements->at(i).tree()->Accept(this, nullptr);
+    }
+    return nullptr;
+  }
+
+  void* VisitQuantifier(RegExpQuantifier* node, void*) override {
+    RegExpTree* body = node->body();
+    int min = node->min();
+    int max = node->max();
+    bool is_unbounded = max == RegExpTree::kInfinity;
+    if (node->is_possessive() || (max > min && body->min_match() == 0) ||
+        (!is_unbounded && max - min > RegExpLinear::kMaxProgramLength)) {
+      ok_ = false;
+      return nullptr;
+    }
+    if (is_unbounded) {
+      if (unbounded_depth_ > 0) has_nested_quantifiers_ = true;
+      unbounded_depth_++;
+    }
+    // Captures inside the body are reset at the start of every iteration.
+    Interval captures = body->CaptureRegisters();
+    for (int i = 0; i < min && ok_; i++) {
+      EmitIteration(body, captures);
+    }
+    if (is_unbounded) {
+      // Greedy:                      Non-greedy:
+      //   loop: FORK end               loop: FORK body
+      //         <body>                       JUMP end
+      //         JUMP loop              body: <body>
+      //   end:                               JUMP loop
+      //                                end:
+      int loop = code_.length();
+      int fork = Emit(Instruction::FORK);
+      int exit = 0;
+      if (node->is_non_greedy()) {
+        exit = Emit(Instruction::JUMP);
+        Bind(fork);
+      }
+      EmitIteration(body, captures);
+      Emit(Instruction::JUMP, loop);
+      Bind(node->is_non_greedy() ? exit : fork);
+      unbounded_depth_--;
+    } else {
+      // Each optional iteration is entered only if the previous one was.
+      ZoneList<int> exits(max - min, zone_);
+      for (int i = min; i < max && ok_; i++) {
+        int fork = Emit(Instruction::FORK);
+        if (node->is_non_greedy()) {
+          exits.Add(Emit(Instruction::JUMP), zone_);
+          Bind(fork);
+        } else {
+          exits.Add(fork, zone_);
+        }
+        EmitIteration(body, captures);
+      }
+      for (int i = 0; i < exits.length(); i++) Bind(exits[i]);
+    }
+    return nullptr;
+  }
+
+  void* VisitCapture(RegExpCapture* node, void*) override {
+    Emit(Instruction::SET_REGISTER,
+         RegExpCapture::StartRegister(node->index()));
+    node->body()->Accept(this, nullptr);
+    Emit(Instruction::SET_REGISTER, RegExpCapture::EndRegister(node->index()));
+    return nullptr;
+  }
+
+  void* VisitGroup(RegExpGroup* node, void*) override {
+    node->body()->Accept(this, nullptr);
+    return nullptr;
+  }
+
+  void* VisitLookaround(RegExpLookaround* node, void*) override {
+    ok_ = false;
+    return nullptr;
+  }
+
+  void* VisitBackReference(RegExpBackReference* node, void*) override {
+    ok_ = false;
+    return nullptr;
+  }
+
+  void* VisitEmpty(RegExpEmpty* node, void*) override { return nullptr; }
+
+ private:
+  // Points the jump or fork at {index} to the next instruction.
+  void Bind(int index) {
+    if (ok_) code_[index].first = code_.length();
+  }
+
+  void EmitIteration(RegExpTree* body, Interval captures) {
+    if (!captures.is_empty()) {
+      Emit(Instruction::CLEAR_REGISTERS, captures.from(), captures.to());
+    }
+    body->Accept(this, nullptr);
+  }
+
+  Zone* zone_;
+  ZoneList<Instruction> code_;
+  bool ok_;
+  int unbounded_depth_;
+  bool has_nested_quantifiers_;
+};
+
+template <typename Char>
+class LinearMatcher {
+ public:
+  LinearMatcher(const Instruction* code, int code_length,
+                Vector<const Char> subject, int register_count)
+      : code_(code),
+        subject_(subject),
+        register_count_(register_count),
+        visited_(code_length, -1),
+        generation_(-1),
+        matched_(false),
+        match_(register_count) {}
+
+  bool Match(int index, bool sticky) {
+    int position = index;
+    generation_ = position;
+    Closure(Thread{0, NewRegisters()}, position, &current_);
+    while (position < subject_.length()) {
+      if (current_.empty() && (matched_ || sticky)) break;
+      Char c = subject_[position];
+      position++;
+      generation_ = position;
+      bool cut = false;
+      for (const Thread& thread : current_) {
+        if (cut || !Consumes(thread.pc, c)) {
+          Release(thread.registers);
+          continue;
+        }
+        // Lower priority threads are dropped once a thread has matched.
+        cut = Closure(Thread{NextPc(thread.pc), thread.registers}, position,
+                      &next_);
+      }
+      current_.clear();
+      std::swap(current_, next_);
+      if (!matched_ && !sticky) {
+        Closure(Thread{0, NewRegisters()}, position, &current_);
+      }
+    }
+    return matched_;
+  }
+
+  const int32_t* match() const { return match_.data(); }
+
+ private:
+  struct Thread {
+    int pc;
+    // Offset of the thread's registers in registers_.
+    int registers;
+  };
+
+  int NewRegisters() {
+    if (!free_registers_.empty()) {
+      int offset = free_registers_.back();
+      free_registers_.pop_back();
+      std::fill_n(registers_.begin() + offset, register_count_, -1);
+      return offset;
+    }
+    int offset = static_cast<int>(registers_.size());
+    registers_.resize(offset + register_count_, -1);
+    return offset;
+  }
+
+  int CopyRegisters(int from) {
+    int offset = NewRegisters();
+    std::copy_n(registers_.begin() + from, register_count_,
+                registers_.begin() + offset);
+    return offset;
+  }
+
+  void Release(int offset) { free_registers_.push_back(offset); }
+
+  bool Consumes(int pc, Char c) const {
+    const Instruction& instruction = code_[pc];
+    if (instruction.opcode == Instruction::CONSUME_RANGE) {
+      return instruction.first <= c && c <= instruction.second;
+    }
+    DCHECK_EQ(Instruction::CONSUME_ANY_OF, instruction.opcode);
+    // The ranges are sorted and disjoint.
+    const Instruction* begin = &code_[pc + 1];
+    const Instruction* end = begin + instruction.first;
+    const Instruction* range = std::lower_bound(
+        begin, end, static_cast<int32_t>(c),
+        [](const Instruction& r, int32_t value) { return r.second < value; });
+    return range != end && range->first <= c;
+  }
+
+  int NextPc(int pc) const {
+    const Instruction& instruction = code_[pc];
+    if (instruction.opcode == Instruction::CONSUME_RANGE) return pc + 1;
+    DCHECK_EQ(Instruction::CONSUME_ANY_OF, instruction.opcode);
+    return pc + 1 + instruction.first;
+  }
+
+  bool IsWordAt(int position) const {
+    return 0 <= position && position < subject_.length() &&
+           IsRegExpWord(subject_[position]);
+  }
+
+  bool Holds(int assertion, int position) const {
+    switch (static_cast<RegExpAssertion::AssertionType>(assertion)) {
+      case RegExpAssertion::START_OF_INPUT:
+        return position == 0;
+      case RegExpAssertion::START_OF_LINE:
+        return position == 0 ||
+               unibrow::IsLineTerminator(subject_[position - 1]);
+      case RegExpAssertion::END_OF_INPUT:
+        return position == subject_.length();
+      case RegExpAssertion::END_OF_LINE:
+        return position == subject_.length() ||
+               unibrow::IsLineTerminator(subject_[position]);
+      case RegExpAssertion::BOUNDARY:
+        return IsWordAt(position - 1) != IsWordAt(position);
+      case RegExpAssertion::NON_BOUNDARY:
+        return IsWordAt(position - 1) == IsWordAt(position);
+    }
+    UNREACHABLE();
+  }
+
+  // Follows {start} and everything forked from it, in priority order, up to
+  // the instructions that consume a character, and appends the threads
+  // blocked there to {list}. A thread that reaches an instruction already
+  // reached in this generation is dropped: the earlier one has a higher
+  // priority and the same future. Returns whether a thread matched, in which
+  // case the lower priority threads were dropped.
+  bool Closure(Thread start, int position, std::vector<Thread>* list) {
+    DCHECK(stack_.empty());
+    stack_.push_back(start);
+    while (!stack_.empty()) {
+      Thread thread = stack_.back();
+      stack_.pop_back();
+      bool alive = true;
+      while (alive) {
+        if (visited_[thread.pc] == generation_) break;
+        visited_[thread.pc] = generation_;
+        const Instruction& instruction = code_[thread.pc];
+        switch (instruction.opcode) {
+          case Instruction::CONSUME_RANGE:
+          case Instruction::CONSUME_ANY_OF:
+            list->push_back(thread);
+            alive = false;
+            continue;
+          case Instruction::FORK:
+            stack_.push_back(
+                Thread{instruction.first, CopyRegisters(thread.registers)});
+            thread.pc++;
+            continue;
+          case Instruction::JUMP:
+            thread.pc = instruction.first;
+            continue;
+          case Instruction::SET_REGISTER:
+            registers_[thread.registers + instruction.first] = position;
+            thread.pc++;
+            continue;
+          case Instruction::CLEAR_REGISTERS:
+            for (int i = instruction.first; i <= instruction.second; i++) {
+              registers_[thread.registers + i] = -1;
+            }
+            thread.pc++;
+            continue;
+          case Instruction::ASSERTION:
+            if (!Holds(instruction.first, position)) break;
+            thread.pc++;
+            continue;
+          case Instruction::ACCEPT:
+            std::copy_n(registers_.begin() + thread.registers,
+                        register_count_, match_.begin());
+            matched_ = true;
+            Release(thread.registers);
+            for (const Thread& dropped : stack_) Release(dropped.registers);
+            stack_.clear();
+            return true;
+          default:
+            UNREACHABLE();
+        }
+        // Only a failed assertion gets here.
+        break;
+      }
+      if (alive) Release(thread.registers);
+    }
+    return false;
+  }
+
+  const Instruction* code_;
+  Vector<const Char> subject_;
+  int register_count_;
+  // The generation in which each instruction was last reached. There is one
+  // generation per subject position.
+  std::vector<int> visited_;
+  int generation_;
+  std::vector<Thread> current_;
+  std::vector<Thread> next_;
+  std::vector<Thread> stack_;
+  std::vector<int32_t> registers_;
+  std::vector<int> free_registers_;
+  bool matched_;
+  std::vector<int32_t> match_;
+};
+
+template <typename Char>
+bool MatchWith(const Instruction* code, int code_length,
+               Vector<const Char> subject, int index, bool sticky,
+               int32_t* output, int register_count) {
+  LinearMatcher<Char> matcher(code, code_length, subject, register_count);
+  if (!matcher.Match(index, sticky)) return false;
+  std::copy_n(matcher.match(), register_count, output);
+  return true;
+}
+
+}  // namespace
+
+MaybeHandle<ByteArray> RegExpLinear::Compile(Isolate* isolate, Zone* zone,
+                                             RegExpTree* tree,
+                                             bool* has_nested_quantifiers) {
+  LinearCompiler compiler(zone);
+  compiler.Emit(Instruction::SET_REGISTER, RegExpCapture::StartRegister(0));
+  tree->Accept(&compiler, nullptr);
+  compiler.Emit(Instruction::SET_REGISTER, RegExpCapture::EndRegister(0));
+  compiler.Emit(Instruction::ACCEPT);
+  if (!compiler.ok()) return MaybeHandle<ByteArray>();
+
+  *has_nested_quantifiers = compiler.has_nested_quantifiers();
+  ZoneList<Instruction>* code = compiler.code();
+  int size = code->length() * static_cast<int>(sizeof(Instruction));
+  Handle<ByteArray> program = isolate->factory()->NewByteArray(size, TENURED);
+  program->copy_in(0, reinterpret_cast<const byte*>(&code->first()), size);
+  return program;
+}
+
+RegExpImpl::IrregexpResult RegExpLinear::Match(ByteArray* program,
+                                               String* subject, int index,
+                                               bool sticky, int32_t* output,
+                                               int register_count) {
+  DisallowHeapAllocation no_gc;
+  const Instruction* code =
+      reinterpret_cast<const Instruction*>(program->GetDataStartAddress());
+  int code_length = program->length() / static_cast<int>(sizeof(Instruction));
+  String::FlatContent content = subject->GetFlatContent();
+  DCHECK(content.IsFlat());
+  bool matched =
+      content.IsOneByte()
+          ? MatchWith(code, code_length, content.ToOneByteVector(), index,
+                      sticky, output, register_count)
+          : MatchWith(code, code_length, content.ToUC16Vector(), index, sticky,
+                      output, register_count);
+  return matched ? RegExpImpl::RE_SUCCESS : RegExpImpl::RE_FAILURE;
+}
+
+}  // namespace internal
+}  // namespace v8
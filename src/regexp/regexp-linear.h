@@ -0,0 +1,58 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A regexp engine whose running time is linear in the length of the subject.
+//
+// The pattern is compiled to a small program for a Thompson NFA, which is
+// simulated one subject character at a time with all alive threads in
+// lockstep (a "Pike VM"). Threads are kept in priority order and at most one
+// thread per instruction survives each step, so matching a subject of length
+// n with a program of m instructions takes O(n * m) steps, whatever the
+// pattern. The threads carry their own capture registers, and the match
+// found is the one a backtracking engine would find.
+//
+// Patterns using backreferences or lookarounds cannot be matched this way,
+// and neither can some other features; see RegExpLinear::Compile.
+
+#ifndef V8_REGEXP_REGEXP_LINEAR_H_
+#define V8_REGEXP_REGEXP_LINEAR_H_
+
+#include "src/regexp/jsregexp.h"
+
+namespace v8 {
+namespace internal {
+
+class RegExpLinear : public AllStatic {
+ public:
+  // Compiles the parsed pattern to a program for the linear-time engine.
+  // Returns an empty handle if the pattern uses a feature the engine does not
+  // support: backreferences, lookarounds, case-insensitive or unicode
+  // matching, possessive quantifiers, and quantifiers with optional
+  // iterations whose body can match the empty string (such an iteration must
+  // not match empty, which cannot be decided from the position alone). Also
+  // gives up if the program would get larger than kMaxProgramLength
+  // instructions.
+  // Sets {has_nested_quantifiers} if an unbounded quantifier is nested in
+  // another one, the shape of pattern on which backtracking can take time
+  // exponential in the length of the subject.
+  static MaybeHandle<ByteArray> Compile(Isolate* isolate, Zone* zone,
+                                        RegExpTree* tree,
+                                        bool* has_nested_quantifiers);
+
+  // Matches {program} against the flat {subject}, starting at {index} and,
+  // unless {sticky}, at every later position until a match is found. On
+  // success, the {register_count} capture registers are written to {output}
+  // and RE_SUCCESS is returned. On failure, {output} is left untouched.
+  // Never allocates on the heap.
+  static RegExpImpl::IrregexpResult Match(ByteArray* program, String* subject,
+                                          int index, bool sticky,
+                                          int32_t* output, int register_count);
+
+  static const int kMaxProgramLength = 1 << 16;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_REGEXP_LINEAR_H_
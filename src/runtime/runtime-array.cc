@@ -417,6 +417,270 @@ RUNTIME_FUNCTION(Runtime_TrySliceSimpleNonFastElements) {
   return *accessor->Slice(object, first, length);
 }
 
+namespace {
+
+// An element that Array.prototype.join converts to a string without calling
+// back into JavaScript: a string, number, boolean, null, undefined or hole.
+class SimpleJoinElement {
+ public:
+  // Returns false if the element at |index| is not simple.
+  bool Set(Isolate* isolate, FixedArrayBase* elements, ElementsKind kind,
+           int index) {
+    string_ = nullptr;
+    chars_ = "";
+    if (IsDoubleElementsKind(kind)) {
+      FixedDoubleArray* doubles = FixedDoubleArray::cast(elements);
+      if (!doubles->is_the_hole(index)) {
+        chars_ = DoubleToCString(doubles->get_scalar(index), buffer());
+      }
+    } else {
+      Object* element = FixedArray::cast(elements)->get(index);
+      if (element->IsSmi()) {
+        chars_ = IntToCString(Smi::ToInt(element), buffer());
+      } else if (element->IsString()) {
+        string_ = String::cast(element);
+      } else if (element->IsHeapNumber()) {
+        chars_ = DoubleToCString(HeapNumber::cast(element)->value(), buffer());
+      } else if (element->IsTrue(isolate)) {
+        chars_ = "true";
+      } else if (element->IsFalse(isolate)) {
+        chars_ = "false";
+      } else if (!element->IsNullOrUndefined(isolate) &&
+                 !element->IsTheHole(isolate)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  int length() const {
+    return string_ != nullptr ? string_->length() : StrLength(chars_);
+  }
+
+  bool IsOneByte() const {
+    return string_ == nullptr || string_->IsOneByteRepresentation();
+  }
+
+  template <typename Char>
+  Char* WriteTo(Char* sink) const {
+    if (string_ != nullptr) {
+      String::WriteToFlat(string_, sink, 0, string_->length());
+      return sink + string_->length();
+    }
+    for (const char* c = chars_; *c != '\0'; c++) *(sink++) = *c;
+    return sink;
+  }
+
+ private:
+  Vector<char> buffer() { return Vector<char>(buffer_, arraysize(buffer_)); }
+
+  String* string_;
+  const char* chars_;
+  char buffer_[kDoubleToCStringMinBufferSize];
+};
+
+template <typename Char>
+void WriteSimpleJoin(Isolate* isolate, JSArray* array, int length,
+                     String* separator, Char* sink) {
+  DisallowHeapAllocation no_gc;
+  FixedArrayBase* elements = array->elements();
+  ElementsKind kind = array->GetElementsKind();
+  int separator_length = separator->length();
+  SimpleJoinElement element;
+  for (int i = 0; i < length; i++) {
+    if (i > 0 && separator_length > 0) {
+      String::WriteToFlat(separator, sink, 0, separator_length);
+      sink += separator_length;
+    }
+    CHECK(element.Set(isolate, elements, kind, i));
+    sink = element.WriteTo(sink);
+  }
+}
+
+}  // namespace
+
+// Joins arrays with fast elements that are all converted to strings without
+// calling back into JavaScript, computing the length of the result first and
+// writing it into a flat string. Returns Smi 0 for all other arrays.
+RUNTIME_FUNCTION(Runtime_TryJoinSimpleElements) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(3, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSReceiver, receiver, 0);
+  CONVERT_ARG_HANDLE_CHECKED(Object, length_object, 1);
+  CONVERT_ARG_HANDLE_CHECKED(String, separator, 2);
+
+  // The length must still match the array, which converting the separator
+  // may have changed.
+  if (!receiver->IsJSArray() || !length_object->IsSmi()) return Smi::kZero;
+  Handle<JSArray> array = Handle<JSArray>::cast(receiver);
+  int length = Smi::ToInt(*length_object);
+  if (!array->length()->IsSmi() || Smi::ToInt(array->length()) != length) {
+    return Smi::kZero;
+  }
+  ElementsKind kind = array->GetElementsKind();
+  if (!IsFastElementsKind(kind)) return Smi::kZero;
+  // Holes read undefined only if there are no elements on the prototypes.
+  if (IsHoleyElementsKind(kind) &&
+      !JSObject::PrototypeHasNoElements(isolate, *array)) {
+    return Smi::kZero;
+  }
+  separator = String::Flatten(separator);
+
+  int result_length = 0;
+  bool one_byte = separator->IsOneByteRepresentation();
+  {
+    DisallowHeapAllocation no_gc;
+    FixedArrayBase* elements = array->elements();
+    DCHECK_LE(length, elements->length());
+    SimpleJoinElement element;
+    STATIC_ASSERT(String::kMaxLength < kMaxInt / 2);
+    for (int i = 0; i < length; i++) {
+      if (!element.Set(isolate, elements, kind, i)) return Smi::kZero;
+      int increment = element.length() + (i > 0 ? separator->length() : 0);
+      // Past the maximum length, keep looking for elements that aren't
+      // simple, which the caller has to convert before failing.
+      if (increment > String::kMaxLength - result_length) {
+        result_length = String::kMaxLength + 1;
+      } else {
+        result_length += increment;
+      }
+      one_byte = one_byte && element.IsOneByte();
+    }
+  }
+  if (result_length > String::kMaxLength) {
+    THROW_NEW_ERROR_RETURN_FAILURE(isolate, NewInvalidStringLengthError());
+  }
+
+  if (one_byte) {
+    Handle<SeqOneByteString> result;
+    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+        isolate, result,
+        isolate->factory()->NewRawOneByteString(result_length));
+    WriteSimpleJoin(isolate, *array, length, *separator, result->GetChars());
+    return *result;
+  }
+  Handle<SeqTwoByteString> result;
+  ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+      isolate, result, isolate->factory()->NewRawTwoByteString(result_length));
+  WriteSimpleJoin(isolate, *array, length, *separator, result->GetChars());
+  return *result;
+}
+
+namespace {
+
+template <typename Char1, typename Char2>
+int CompareFlatChars(Vector<const Char1> x, Vector<const Char2> y) {
+  int result =
+      CompareChars(x.start(), y.start(), std::min(x.length(), y.length()));
+  return result != 0 ? result : x.length() - y.length();
+}
+
+// Compares flat strings by their UTF-16 code units like the default
+// comparator of Array.prototype.sort.
+bool FlatStringLessThan(String* x, String* y) {
+  DisallowHeapAllocation no_gc;
+  String::FlatContent x_content = x->GetFlatContent();
+  String::FlatContent y_content = y->GetFlatContent();
+  DCHECK(x_content.IsFlat() && y_content.IsFlat());
+  if (x_content.IsOneByte()) {
+    if (y_content.IsOneByte()) {
+      return CompareFlatChars(x_content.ToOneByteVector(),
+                              y_content.ToOneByteVector()) < 0;
+    }
+    return CompareFlatChars(x_content.ToOneByteVector(),
+                            y_content.ToUC16Vector()) < 0;
+  }
+  if (y_content.IsOneByte()) {
+    return CompareFlatChars(x_content.ToUC16Vector(),
+                            y_content.ToOneByteVector()) < 0;
+  }
+  return CompareFlatChars(x_content.ToUC16Vector(),
+                          y_content.ToUC16Vector()) < 0;
+}
+
+}  // namespace
+
+// Stably sorts the first |length| elements of arrays with fast elements
+// under the default comparator, if the elements are numbers, strings,
+// booleans or null and so are converted to strings without calling back
+// into JavaScript. Holes and undefined must have been moved to the end by
+// %RemoveArrayHoles. Returns whether the elements were sorted.
+RUNTIME_FUNCTION(Runtime_TrySortSimpleElements) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(2, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSReceiver, receiver, 0);
+  CONVERT_NUMBER_CHECKED(uint32_t, length, Uint32, args[1]);
+
+  if (!receiver->IsJSArray()) return isolate->heap()->false_value();
+  Handle<JSArray> array = Handle<JSArray>::cast(receiver);
+  ElementsKind kind = array->GetElementsKind();
+  if (!IsFastElementsKind(kind) ||
+      length > static_cast<uint32_t>(array->elements()->length())) {
+    return isolate->heap()->false_value();
+  }
+  JSObject::EnsureWritableFastElements(array);
+
+  if (IsSmiElementsKind(kind)) {
+    DisallowHeapAllocation no_gc;
+    FixedArray* elements = FixedArray::cast(array->elements());
+    for (uint32_t i = 0; i < length; i++) {
+      if (!elements->get(i)->IsSmi()) return isolate->heap()->false_value();
+    }
+    Object** start = elements->data_start();
+    std::stable_sort(start, start + length, [](Object* x, Object* y) {
+      return Smi::LexicographicCompare(Smi::cast(x), Smi::cast(y)) < 0;
+    });
+    return isolate->heap()->true_value();
+  }
+
+  // Compute the string each element is compared by once.
+  Handle<FixedArray> keys = isolate->factory()->NewFixedArray(length);
+  for (uint32_t i = 0; i < length; i++) {
+    Handle<Object> key;
+    if (IsDoubleElementsKind(kind)) {
+      FixedDoubleArray* elements = FixedDoubleArray::cast(array->elements());
+      if (elements->is_the_hole(i)) return isolate->heap()->false_value();
+      key = isolate->factory()->NewNumber(elements->get_scalar(i));
+    } else {
+      key = handle(FixedArray::cast(array->elements())->get(i), isolate);
+    }
+    if (key->IsString()) {
+      key = String::Flatten(Handle<String>::cast(key));
+    } else if (key->IsNumber()) {
+      key = isolate->factory()->NumberToString(key);
+    } else if (key->IsBoolean() || key->IsNull(isolate)) {
+      key = handle(Oddball::cast(*key)->to_string(), isolate);
+    } else {
+      return isolate->heap()->false_value();
+    }
+    keys->set(i, *key);
+  }
+
+  DisallowHeapAllocation no_gc;
+  std::vector<uint32_t> order(length);
+  for (uint32_t i = 0; i < length; i++) order[i] = i;
+  std::stable_sort(order.begin(), order.end(),
+                   [&keys](uint32_t x, uint32_t y) {
+                     return FlatStringLessThan(String::cast(keys->get(x)),
+                                               String::cast(keys->get(y)));
+                   });
+  if (IsDoubleElementsKind(kind)) {
+    FixedDoubleArray* elements = FixedDoubleArray::cast(array->elements());
+    std::vector<double> values(length);
+    for (uint32_t i = 0; i < length; i++) values[i] = elements->get_scalar(i);
+    for (uint32_t i = 0; i < length; i++) elements->set(i, values[order[i]]);
+  } else {
+    FixedArray* elements = FixedArray::cast(array->elements());
+    std::vector<Object*> values(length);
+    for (uint32_t i = 0; i < length; i++) values[i] = elements->get(i);
+    WriteBarrierMode mode = elements->GetWriteBarrierMode(no_gc);
+    for (uint32_t i = 0; i < length; i++) {
+      elements->set(i, values[order[i]], mode);
+    }
+  }
+  return isolate->heap()->true_value();
+}
+
 RUNTIME_FUNCTION(Runtime_NewArray) {
   HandleScope scope(isolate);
   DCHECK_LE(3, args.length());
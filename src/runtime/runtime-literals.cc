@@ -9,6 +9,7 @@
 #include "src/ast/ast.h"
 #include "src/ast/compile-time-value.h"
 #include "src/isolate-inl.h"
+#include "src/json-parser.h"
 #include "src/runtime/runtime.h"
 
 namespace v8 {
@@ -514,6 +515,34 @@ MaybeHandle<JSObject> CreateLiteral(Isolate* isolate,
   usage_context.ExitScope(site, boilerplate);
   return copy;
 }
+
+// Creates the value of a JsonLiteral from its range of the script source.
+MaybeHandle<Object> ParseJsonLiteral(Isolate* isolate,
+                                     Handle<JSFunction> closure,
+                                     int start_position, int end_position) {
+  Handle<String> source(
+      String::cast(Script::cast(closure->shared()->script())->source()),
+      isolate);
+  source = String::Flatten(source);
+  Handle<Object> reviver = isolate->factory()->undefined_value();
+
+  // Copy one-byte text so that the JSON parser can use its sequential fast
+  // path, which it can't on a slice of an external script source.
+  if (source->IsOneByteRepresentation()) {
+    Handle<SeqOneByteString> json;
+    ASSIGN_RETURN_ON_EXCEPTION(
+        isolate, json,
+        isolate->factory()->NewRawOneByteString(end_position -
+                                                start_position),
+        Object);
+    String::WriteToFlat(*source, json->GetChars(), start_position,
+                        end_position);
+    return JsonParser<true>::Parse(isolate, json, reviver);
+  }
+  Handle<String> json =
+      isolate->factory()->NewSubString(source, start_position, end_position);
+  return JsonParser<false>::Parse(isolate, json, reviver);
+}
 }  // namespace
 
 RUNTIME_FUNCTION(Runtime_CreateObjectLiteral) {
@@ -565,5 +594,50 @@ RUNTIME_FUNCTION(Runtime_CreateRegExpLiteral) {
   return *JSRegExp::Copy(Handle<JSRegExp>::cast(boilerplate));
 }
 
+RUNTIME_FUNCTION(Runtime_CreateJsonLiteral) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(4, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSFunction, closure, 0);
+  CONVERT_SMI_ARG_CHECKED(index, 1);
+  CONVERT_SMI_ARG_CHECKED(start_position, 2);
+  CONVERT_SMI_ARG_CHECKED(end_position, 3);
+
+  Handle<FeedbackVector> vector(closure->feedback_vector(), isolate);
+  FeedbackSlot literal_slot(FeedbackVector::ToSlot(index));
+  CHECK(literal_slot.ToInt() < vector->length());
+
+  // Like the other literals, the first evaluation returns a fresh value and
+  // later ones copy a boilerplate, so the source is parsed at most twice.
+  Handle<Object> literal_site(vector->Get(literal_slot), isolate);
+  Handle<AllocationSite> site;
+  Handle<JSObject> boilerplate;
+  if (HasBoilerplate(isolate, literal_site)) {
+    site = Handle<AllocationSite>::cast(literal_site);
+    boilerplate = Handle<JSObject>(site->boilerplate(), isolate);
+  } else {
+    Handle<Object> value;
+    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+        isolate, value,
+        ParseJsonLiteral(isolate, closure, start_position, end_position));
+    if (IsUninitializedLiteralSite(*literal_site)) {
+      PreInitializeLiteralSite(vector, literal_slot);
+      return *value;
+    }
+    boilerplate = Handle<JSObject>::cast(value);
+    AllocationSiteCreationContext creation_context(isolate);
+    site = creation_context.EnterNewScope();
+    RETURN_FAILURE_ON_EXCEPTION(isolate,
+                                DeepWalk(boilerplate, &creation_context));
+    creation_context.ExitScope(site, boilerplate);
+    vector->Set(literal_slot, *site);
+  }
+
+  AllocationSiteUsageContext usage_context(isolate, site, true);
+  usage_context.EnterNewScope();
+  MaybeHandle<JSObject> copy = DeepCopy(boilerplate, &usage_context, kNoHints);
+  usage_context.ExitScope(site, boilerplate);
+  RETURN_RESULT_OR_FAILURE(isolate, copy);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -325,7 +325,7 @@ bool CompiledReplacement::Compile(Handle<JSRegExp> regexp,
 
     FixedArray* capture_name_map = nullptr;
     if (capture_count > 0) {
-      DCHECK_EQ(regexp->TypeTag(), JSRegExp::IRREGEXP);
+      DCHECK_NE(regexp->TypeTag(), JSRegExp::ATOM);
       Object* maybe_capture_name_map = regexp->CaptureNameMap();
       if (maybe_capture_name_map->IsFixedArray()) {
         DCHECK(FLAG_harmony_regexp_named_captures);
@@ -428,13 +428,15 @@ void FindOneByteStringIndices(Vector<const uint8_t> subject, uint8_t pattern,
 void FindTwoByteStringIndices(const Vector<const uc16> subject, uc16 pattern,
                               std::vector<int>* indices, unsigned int limit) {
   DCHECK_LT(0, limit);
-  const uc16* subject_start = subject.start();
-  const uc16* subject_end = subject_start + subject.length();
-  for (const uc16* pos = subject_start; pos < subject_end && limit > 0; pos++) {
-    if (*pos == pattern) {
-      indices->push_back(static_cast<int>(pos - subject_start));
-      limit--;
-    }
+  // Collect indices of pattern in subject a word at a time.
+  // Stop after finding at most limit values.
+  int index = 0;
+  while (limit > 0) {
+    index = FindTwoByteCharacter(subject, pattern, index, subject.length());
+    if (index < 0) return;
+    indices->push_back(index);
+    index++;
+    limit--;
   }
 }
 
@@ -943,7 +945,8 @@ class MatchInfoBackedMatch : public String::Match {
       : isolate_(isolate), match_info_(match_info) {
     subject_ = String::Flatten(subject);
 
-    if (regexp->TypeTag() == JSRegExp::IRREGEXP) {
+    if (regexp->TypeTag() == JSRegExp::IRREGEXP ||
+        regexp->TypeTag() == JSRegExp::LINEAR) {
       Object* o = regexp->CaptureNameMap();
       has_named_captures_ = o->IsFixedArray();
       if (has_named_captures_) {
@@ -1486,8 +1489,8 @@ RUNTIME_FUNCTION(Runtime_StringReplaceNonGlobalRegExpWithFunction) {
   bool has_named_captures = false;
   Handle<FixedArray> capture_map;
   if (m > 1) {
-    // The existence of capture groups implies IRREGEXP kind.
-    DCHECK_EQ(regexp->TypeTag(), JSRegExp::IRREGEXP);
+    // The existence of capture groups implies IRREGEXP or LINEAR kind.
+    DCHECK_NE(regexp->TypeTag(), JSRegExp::ATOM);
 
     Object* maybe_capture_map = regexp->CaptureNameMap();
     if (maybe_capture_map->IsFixedArray()) {
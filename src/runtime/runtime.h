@@ -51,6 +51,8 @@ namespace internal {
   F(NormalizeElements, 1, 1)        \
   F(RemoveArrayHoles, 2, 1)         \
   F(TransitionElementsKind, 2, 1)   \
+  F(TryJoinSimpleElements, 3, 1)    \
+  F(TrySortSimpleElements, 2, 1)    \
   F(TrySliceSimpleNonFastElements, 3, 1)
 
 #define FOR_EACH_INTRINSIC_ATOMICS(F)  \
@@ -320,6 +322,7 @@ namespace internal {
 
 #define FOR_EACH_INTRINSIC_LITERALS(F) \
   F(CreateArrayLiteral, 4, 1)          \
+  F(CreateJsonLiteral, 4, 1)           \
   F(CreateObjectLiteral, 4, 1)         \
   F(CreateRegExpLiteral, 4, 1)
 
@@ -0,0 +1,39 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_RYU_DTOA_H_
+#define V8_RYU_DTOA_H_
+
+#include "src/vector.h"
+
+namespace v8 {
+namespace internal {
+
+// RyuDtoa will produce at most kRyuDtoaMaximalLength digits. This does not
+// include the terminating '\0' character.
+const int kRyuDtoaMaximalLength = 17;
+
+// Computes the shortest decimal representation of v, using Ulf Adams' Ryu
+// algorithm ("Ryu: fast float-to-string conversion", PLDI 2018).
+// The result should be interpreted as buffer * 10^(point - length).
+//
+// Precondition:
+//   * v must be a strictly positive finite double.
+//
+// Unlike FastDtoa this never fails: the interval of decimals that round to v
+// is computed with 128-bit multiplications by a precomputed power of five,
+// which is precise enough for every double, so no bignum fallback is needed.
+// The result satisfies
+//     v == (double) (buffer * 10^(point - length)).
+// The digits in the buffer are the shortest representation possible, and
+// among those the one closest to v. Exact ties are broken towards an even
+// last digit, like BignumDtoa does.
+// There will be *length digits inside the buffer followed by a null terminator.
+// The buffer must be able to hold kRyuDtoaMaximalLength + 1 characters.
+void RyuDtoa(double v, Vector<char> buffer, int* length, int* point);
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_RYU_DTOA_H_
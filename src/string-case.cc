@@ -8,6 +8,7 @@
 #include "src/base/logging.h"
 #include "src/globals.h"
 #include "src/utils.h"
+#include "src/word-lanes.h"
 
 namespace v8 {
 namespace internal {
@@ -31,9 +32,6 @@ bool CheckFastAsciiConvert(char* dst, const char* src, int length, bool changed,
 }
 #endif
 
-const uintptr_t kOneInEveryByte = kUintptrAllBitsSet / 0xFF;
-const uintptr_t kAsciiMask = kOneInEveryByte << 7;
-
 // Given a word and two range boundaries returns a word with high bit
 // set in every byte iff the corresponding input byte was strictly in
 // the range (m, n). All the other bits in the result are cleared.
@@ -5,6 +5,7 @@
 #ifndef V8_STRING_HASHER_INL_H_
 #define V8_STRING_HASHER_INL_H_
 
+#include "src/base/bits.h"
 #include "src/char-predicates-inl.h"
 #include "src/objects.h"
 #include "src/string-hasher.h"
@@ -15,6 +16,8 @@ namespace internal {
 StringHasher::StringHasher(int length, uint32_t seed)
     : length_(length),
       raw_running_hash_(seed),
+      pending_block_(0),
+      pending_chars_(0),
       array_index_(0),
       is_array_index_(0 < length_ && length_ <= String::kMaxArrayIndexSize),
       is_first_char_(true) {
@@ -42,32 +45,56 @@ uint32_t StringHasher::GetHashCore(uint32_t running_hash) {
   return running_hash;
 }
 
-uint32_t StringHasher::ComputeRunningHash(uint32_t running_hash,
-                                          const uc16* chars, int length) {
-  DCHECK_NOT_NULL(chars);
-  DCHECK_GE(length, 0);
-  for (int i = 0; i < length; ++i) {
-    running_hash = AddCharacterCore(running_hash, *chars++);
-  }
-  return running_hash;
+uint64_t StringHasher::ReadBlock(const uint8_t* chars) {
+  uint64_t block = static_cast<uint32_t>(chars[0]) |
+                   static_cast<uint32_t>(chars[1]) << 8 |
+                   static_cast<uint32_t>(chars[2]) << 16 |
+                   static_cast<uint32_t>(chars[3]) << 24;
+  // Spread the bytes into 16-bit lanes.
+  block = (block | (block << 16)) & uint64_t{0x0000FFFF0000FFFF};
+  block = (block | (block << 8)) & uint64_t{0x00FF00FF00FF00FF};
+  return block;
 }
 
-uint32_t StringHasher::ComputeRunningHashOneByte(uint32_t running_hash,
-                                                 const char* chars,
-                                                 int length) {
-  DCHECK_NOT_NULL(chars);
-  DCHECK_GE(length, 0);
-  for (int i = 0; i < length; ++i) {
-    uint16_t c = static_cast<uint16_t>(*chars++);
-    running_hash = AddCharacterCore(running_hash, c);
-  }
-  return running_hash;
+uint64_t StringHasher::ReadBlock(const uint16_t* chars) {
+  return static_cast<uint64_t>(chars[0]) |
+         static_cast<uint64_t>(chars[1]) << 16 |
+         static_cast<uint64_t>(chars[2]) << 32 |
+         static_cast<uint64_t>(chars[3]) << 48;
+}
+
+uint64_t StringHasher::AddBlockCore(uint64_t running_hash, uint64_t block) {
+  // The block and state mixing of MurmurHash3. Only the last two steps depend
+  // on the running hash, so consecutive blocks overlap in the pipeline.
+  block *= uint64_t{0x87C37B91114253D5};
+  block = base::bits::RotateLeft64(block, 31);
+  block *= uint64_t{0x4CF5AD432745937F};
+  running_hash ^= block;
+  return base::bits::RotateLeft64(running_hash, 27) * 5 + 0x52DCE729;
+}
+
+uint32_t StringHasher::GetBlockHashCore(uint64_t running_hash,
+                                        uint64_t last_block, int length) {
+  running_hash = AddBlockCore(running_hash, last_block);
+  running_hash ^= static_cast<uint64_t>(length);
+  // The finalizer of MurmurHash3.
+  running_hash ^= running_hash >> 33;
+  running_hash *= uint64_t{0xFF51AFD7ED558CCD};
+  running_hash ^= running_hash >> 33;
+  running_hash *= uint64_t{0xC4CEB9FE1A85EC53};
+  running_hash ^= running_hash >> 33;
+  uint32_t hash = static_cast<uint32_t>(running_hash);
+  if ((hash & String::kHashBitMask) == 0) return kZeroHash;
+  return hash;
 }
 
 void StringHasher::AddCharacter(uint16_t c) {
-  // Use the Jenkins one-at-a-time hash function to update the hash
-  // for the given character.
-  raw_running_hash_ = AddCharacterCore(raw_running_hash_, c);
+  pending_block_ |= static_cast<uint64_t>(c) << (16 * pending_chars_);
+  if (++pending_chars_ == kCharsPerBlock) {
+    raw_running_hash_ = AddBlockCore(raw_running_hash_, pending_block_);
+    pending_block_ = 0;
+    pending_chars_ = 0;
+  }
 }
 
 bool StringHasher::UpdateIndex(uint16_t c) {
@@ -95,20 +122,24 @@ bool StringHasher::UpdateIndex(uint16_t c) {
 template <typename Char>
 inline void StringHasher::AddCharacters(const Char* chars, int length) {
   DCHECK(sizeof(Char) == 1 || sizeof(Char) == 2);
+  typedef typename std::make_unsigned<Char>::type UChar;
+  const UChar* uchars = reinterpret_cast<const UChar*>(chars);
   int i = 0;
   if (is_array_index_) {
     for (; i < length; i++) {
-      AddCharacter(chars[i]);
-      if (!UpdateIndex(chars[i])) {
+      AddCharacter(uchars[i]);
+      if (!UpdateIndex(uchars[i])) {
         i++;
         break;
       }
     }
   }
-  for (; i < length; i++) {
-    DCHECK(!is_array_index_);
-    AddCharacter(chars[i]);
+  DCHECK(i == length || !is_array_index_);
+  for (; i < length && pending_chars_ != 0; i++) AddCharacter(uchars[i]);
+  for (; i <= length - kCharsPerBlock; i += kCharsPerBlock) {
+    raw_running_hash_ = AddBlockCore(raw_running_hash_, ReadBlock(uchars + i));
   }
+  for (; i < length; i++) AddCharacter(uchars[i]);
 }
 
 template <typename schar>
@@ -119,6 +150,24 @@ uint32_t StringHasher::HashSequentialString(const schar* chars, int length,
   return hasher.GetHashField();
 }
 
+template <typename schar>
+uint32_t StringHasher::HashSequentialStringOneAtATime(const schar* chars,
+                                                      int length,
+                                                      uint32_t seed) {
+  StringHasher hasher(length, seed);
+  if (hasher.has_trivial_hash()) return hasher.GetHashField();
+  uint32_t running_hash = seed;
+  for (int i = 0; i < length; i++) {
+    running_hash = AddCharacterCore(running_hash, chars[i]);
+    if (hasher.is_array_index_) hasher.UpdateIndex(chars[i]);
+  }
+  if (hasher.is_array_index_) {
+    return MakeArrayIndexHash(hasher.array_index_, length);
+  }
+  return (GetHashCore(running_hash) << String::kHashShift) |
+         String::kIsNotArrayIndexMask;
+}
+
 IteratingStringHasher::IteratingStringHasher(int len, uint32_t seed)
     : StringHasher(len, seed) {}
 
@@ -38,14 +38,29 @@ class V8_EXPORT_PRIVATE StringHasher {
   // use 27 instead.
   static const int kZeroHash = 27;
 
-  // Reusable parts of the hashing algorithm.
+  // Hashes the characters with the one-at-a-time hash strings used before
+  // they were hashed a block at a time. Wasm script names and function
+  // hashes are derived from it and shown by debuggers, so they keep it.
+  template <typename schar>
+  static inline uint32_t HashSequentialStringOneAtATime(const schar* chars,
+                                                        int length,
+                                                        uint32_t seed);
+
+  // Parts of the one-at-a-time hash, also used for hashes that are built up
+  // a value at a time but are not string hashes.
   INLINE(static uint32_t AddCharacterCore(uint32_t running_hash, uint16_t c));
   INLINE(static uint32_t GetHashCore(uint32_t running_hash));
-  INLINE(static uint32_t ComputeRunningHash(uint32_t running_hash,
-                                            const uc16* chars, int length));
-  INLINE(static uint32_t ComputeRunningHashOneByte(uint32_t running_hash,
-                                                   const char* chars,
-                                                   int length));
+
+  // Characters are mixed into the running hash in blocks. A block holds the
+  // code units of kCharsPerBlock consecutive characters in consecutive 16-bit
+  // lanes, first character in the lowest lane, so one-byte and two-byte
+  // strings with the same characters hash the same.
+  static const int kCharsPerBlock = 4;
+  static inline uint64_t ReadBlock(const uint8_t* chars);
+  static inline uint64_t ReadBlock(const uint16_t* chars);
+  INLINE(static uint64_t AddBlockCore(uint64_t running_hash, uint64_t block));
+  INLINE(static uint32_t GetBlockHashCore(uint64_t running_hash,
+                                          uint64_t last_block, int length));
 
  protected:
   // Returns the value to store in the hash field of a string with
@@ -65,7 +80,10 @@ class V8_EXPORT_PRIVATE StringHasher {
   inline bool UpdateIndex(uint16_t c);
 
   int length_;
-  uint32_t raw_running_hash_;
+  uint64_t raw_running_hash_;
+  // The characters of the current, incomplete block.
+  uint64_t pending_block_;
+  int pending_chars_;
   uint32_t array_index_;
   bool is_array_index_;
   bool is_first_char_;
@@ -7,6 +7,7 @@
 
 #include "src/isolate.h"
 #include "src/vector.h"
+#include "src/word-lanes.h"
 
 namespace v8 {
 namespace internal {
@@ -190,43 +191,58 @@ class StringSearch : private StringSearchBase {
 };
 
 
-template <typename T, typename U>
-inline T AlignDown(T value, U alignment) {
-  return reinterpret_cast<T>(
-      (reinterpret_cast<uintptr_t>(value) & ~(alignment - 1)));
+// Returns the index of the first occurrence of |c| in subject[index, limit[,
+// or -1 if there is none. memchr can only look for one of the two bytes of a
+// character, so on two-byte subjects it would stop at every character sharing
+// that byte; this checks whole characters a word at a time instead.
+inline int FindTwoByteCharacter(Vector<const uc16> subject, uc16 c, int index,
+                                int limit) {
+  DCHECK_LE(0, index);
+  DCHECK_LE(limit, subject.length());
+  const uc16* start = subject.start();
+  const uc16* pos = start + index;
+  const uc16* end = start + limit;
+  // Check unaligned characters.
+  while (pos < end &&
+         !IsAligned(reinterpret_cast<intptr_t>(pos), sizeof(uintptr_t))) {
+    if (*pos == c) return static_cast<int>(pos - start);
+    ++pos;
+  }
+  // Check aligned words. The exact position is left to the loop below.
+  while (pos + kUc16PerWord <= end) {
+    uintptr_t word = *reinterpret_cast<const uintptr_t*>(pos);
+    if (HasUc16(word, c)) break;
+    pos += kUc16PerWord;
+  }
+  // Check the remaining characters.
+  while (pos < end) {
+    if (*pos == c) return static_cast<int>(pos - start);
+    ++pos;
+  }
+  return -1;
 }
 
 
-inline uint8_t GetHighestValueByte(uc16 character) {
-  return Max(static_cast<uint8_t>(character & 0xFF),
-             static_cast<uint8_t>(character >> 8));
+template <typename PatternChar>
+inline int FindFirstCharacter(Vector<const PatternChar> pattern,
+                              Vector<const uint8_t> subject, int index) {
+  const int max_n = (subject.length() - pattern.length() + 1);
+  DCHECK_GE(max_n - index, 0);
+  const uint8_t search_char = static_cast<uint8_t>(pattern[0]);
+  const uint8_t* char_pos = reinterpret_cast<const uint8_t*>(
+      memchr(subject.start() + index, search_char, max_n - index));
+  if (char_pos == nullptr) return -1;
+  return static_cast<int>(char_pos - subject.start());
 }
 
 
-inline uint8_t GetHighestValueByte(uint8_t character) { return character; }
-
-
-template <typename PatternChar, typename SubjectChar>
+template <typename PatternChar>
 inline int FindFirstCharacter(Vector<const PatternChar> pattern,
-                              Vector<const SubjectChar> subject, int index) {
-  const PatternChar pattern_first_char = pattern[0];
+                              Vector<const uc16> subject, int index) {
   const int max_n = (subject.length() - pattern.length() + 1);
-
-  const uint8_t search_byte = GetHighestValueByte(pattern_first_char);
-  const SubjectChar search_char = static_cast<SubjectChar>(pattern_first_char);
-  int pos = index;
-  do {
-    DCHECK_GE(max_n - pos, 0);
-    const SubjectChar* char_pos = reinterpret_cast<const SubjectChar*>(
-        memchr(subject.start() + pos, search_byte,
-               (max_n - pos) * sizeof(SubjectChar)));
-    if (char_pos == nullptr) return -1;
-    char_pos = AlignDown(char_pos, sizeof(SubjectChar));
-    pos = static_cast<int>(char_pos - subject.start());
-    if (subject[pos] == search_char) return pos;
-  } while (++pos < max_n);
-
-  return -1;
+  DCHECK_GE(max_n - index, 0);
+  return FindTwoByteCharacter(subject, static_cast<uc16>(pattern[0]), index,
+                              max_n);
 }
 
 
@@ -271,6 +287,9 @@ inline bool CharCompare(const PatternChar* pattern,
 
 
 // Simple linear search for short patterns. Never bails out.
+// Candidate positions are filtered by both their first and their last
+// character before the characters in between are compared. On two-byte
+// subjects kUc16PerWord positions are filtered at a time.
 template <typename PatternChar, typename SubjectChar>
 int StringSearch<PatternChar, SubjectChar>::LinearSearch(
     StringSearch<PatternChar, SubjectChar>* search,
@@ -279,20 +298,42 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
   Vector<const PatternChar> pattern = search->pattern_;
   DCHECK_GT(pattern.length(), 1);
   int pattern_length = pattern.length();
+  const SubjectChar first_char = static_cast<SubjectChar>(pattern[0]);
+  const SubjectChar last_char =
+      static_cast<SubjectChar>(pattern[pattern_length - 1]);
   int i = index;
   int n = subject.length() - pattern_length;
+  if (sizeof(SubjectChar) == 2) {
+    const uc16* chars = reinterpret_cast<const uc16*>(subject.start());
+    while (i + kUc16PerWord - 1 <= n) {
+      uintptr_t firsts = ReadUnalignedValue<uintptr_t>(chars + i);
+      uintptr_t lasts =
+          ReadUnalignedValue<uintptr_t>(chars + i + pattern_length - 1);
+      if ((MatchUc16(firsts, first_char) & MatchUc16(lasts, last_char)) != 0) {
+        for (int j = i; j < i + kUc16PerWord; j++) {
+          if (subject[j] == first_char &&
+              subject[j + pattern_length - 1] == last_char &&
+              (pattern_length == 2 ||
+               CharCompare(pattern.start() + 1, subject.start() + j + 1,
+                           pattern_length - 2))) {
+            return j;
+          }
+        }
+      }
+      i += kUc16PerWord;
+    }
+  }
   while (i <= n) {
     i = FindFirstCharacter(pattern, subject, i);
     if (i == -1) return -1;
     DCHECK_LE(i, n);
-    i++;
-    // Loop extracted to separate function to allow using return to do
-    // a deeper break.
-    if (CharCompare(pattern.start() + 1,
-                    subject.start() + i,
-                    pattern_length - 1)) {
-      return i - 1;
+    if (subject[i + pattern_length - 1] == last_char &&
+        (pattern_length == 2 ||
+         CharCompare(pattern.start() + 1, subject.start() + i + 1,
+                     pattern_length - 2))) {
+      return i;
     }
+    i++;
   }
   return -1;
 }
@@ -50,38 +50,108 @@ bool Utf8Iterator::Done() {
   return offset_ == static_cast<size_t>(stream_.length());
 }
 
+namespace {
+
+// Returns the number of UTF-16 code units the given bytes decode to. Runs of
+// ASCII characters are counted in bulk.
+size_t CountUtf16CodeUnits(const byte* bytes, size_t length) {
+  size_t utf16_length = 0;
+  size_t cursor = 0;
+  while (cursor < length) {
+    size_t ascii_length = Utf8::NonAsciiStart(bytes + cursor, length - cursor);
+    utf16_length += ascii_length;
+    cursor += ascii_length;
+    if (cursor == length) break;
+    uchar c = Utf8::ValueOf(bytes + cursor, length - cursor, &cursor);
+    utf16_length += c > Utf16::kMaxNonSurrogateCharCode ? 2 : 1;
+  }
+  return utf16_length;
+}
+
+}  // namespace
+
 void Utf8DecoderBase::Reset(uint16_t* buffer, size_t buffer_length,
                             const v8::internal::Vector<const char>& stream) {
+  const byte* bytes = reinterpret_cast<const byte*>(stream.begin());
+  size_t length = stream.length();
+  size_t cursor = 0;
   size_t utf16_length = 0;
+  trailing_ = false;
 
-  Utf8Iterator it = Utf8Iterator(stream);
-  // Loop until stream is read, writing to buffer as long as buffer has space.
-  while (utf16_length < buffer_length && !it.Done()) {
-    *buffer++ = *it;
-    ++it;
-    utf16_length++;
+  // Decode into the buffer as long as it has space, widening runs of ASCII
+  // characters in bulk.
+  while (cursor < length && utf16_length < buffer_length) {
+    size_t ascii_length =
+        std::min(Utf8::NonAsciiStart(bytes + cursor, length - cursor),
+                 buffer_length - utf16_length);
+    v8::internal::CopyChars(buffer + utf16_length, bytes + cursor,
+                            ascii_length);
+    utf16_length += ascii_length;
+    cursor += ascii_length;
+    if (cursor == length || utf16_length == buffer_length) break;
+
+    size_t char_start = cursor;
+    uchar c = Utf8::ValueOf(bytes + cursor, length - cursor, &cursor);
+    if (c <= Utf16::kMaxNonSurrogateCharCode) {
+      buffer[utf16_length++] = static_cast<uint16_t>(c);
+      continue;
+    }
+    buffer[utf16_length++] = Utf16::LeadSurrogate(c);
+    if (utf16_length == buffer_length) {
+      // Only the lead surrogate fit; the trail surrogate is written by
+      // WriteUtf16Slow, starting over from the same character.
+      bytes_read_ = char_start;
+      trailing_ = true;
+      chars_written_ = utf16_length;
+      utf16_length_ = utf16_length + 1 +
+                      CountUtf16CodeUnits(bytes + cursor, length - cursor);
+      return;
+    }
+    buffer[utf16_length++] = Utf16::TrailSurrogate(c);
   }
-  bytes_read_ = it.Offset();
-  trailing_ = it.Trailing();
+  bytes_read_ = cursor;
   chars_written_ = utf16_length;
 
   // Now that writing to buffer is done, we just need to calculate utf16_length
-  while (!it.Done()) {
-    ++it;
-    utf16_length++;
-  }
-  utf16_length_ = utf16_length;
+  utf16_length_ =
+      utf16_length + CountUtf16CodeUnits(bytes + cursor, length - cursor);
 }
 
 void Utf8DecoderBase::WriteUtf16Slow(
     uint16_t* data, size_t length,
     const v8::internal::Vector<const char>& stream, size_t offset,
     bool trailing) {
-  Utf8Iterator it = Utf8Iterator(stream, offset, trailing);
-  while (!it.Done()) {
-    DCHECK_GT(length--, 0);
-    *data++ = *it;
-    ++it;
+  const byte* bytes = reinterpret_cast<const byte*>(stream.begin());
+  size_t stream_length = stream.length();
+  size_t cursor = offset;
+  if (trailing) {
+    uchar c = Utf8::ValueOf(bytes + cursor, stream_length - cursor, &cursor);
+    DCHECK_GT(c, Utf16::kMaxNonSurrogateCharCode);
+    DCHECK_GT(length, 0);
+    length--;
+    *data++ = Utf16::TrailSurrogate(c);
+  }
+  while (cursor < stream_length) {
+    size_t ascii_length =
+        Utf8::NonAsciiStart(bytes + cursor, stream_length - cursor);
+    DCHECK_LE(ascii_length, length);
+    v8::internal::CopyChars(data, bytes + cursor, ascii_length);
+    data += ascii_length;
+    length -= ascii_length;
+    cursor += ascii_length;
+    if (cursor == stream_length) break;
+
+    uchar c = Utf8::ValueOf(bytes + cursor, stream_length - cursor, &cursor);
+    if (c <= Utf16::kMaxNonSurrogateCharCode) {
+      DCHECK_GT(length, 0);
+      length--;
+      *data++ = static_cast<uint16_t>(c);
+    } else {
+      DCHECK_GT(length, 1);
+      length -= 2;
+      *data++ = Utf16::LeadSurrogate(c);
+      *data++ = Utf16::TrailSurrogate(c);
+    }
   }
 }
 
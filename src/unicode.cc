@@ -275,6 +275,11 @@ bool Utf8::ValidateEncoding(const byte* bytes, size_t length) {
   State state = State::kAccept;
   Utf8IncrementalBuffer throw_away = 0;
   for (size_t i = 0; i < length && state != State::kReject; i++) {
+    // Runs of ASCII characters are always valid and skipped in bulk.
+    if (state == State::kAccept) {
+      i += NonAsciiStart(bytes + i, length - i);
+      if (i == length) break;
+    }
     Utf8DfaDecoder::Decode(bytes[i], &state, &throw_away);
   }
   return state == State::kAccept;
@@ -9,6 +9,7 @@
 #include "src/globals.h"
 #include "src/third_party/utf8-decoder/utf8-decoder.h"
 #include "src/utils.h"
+#include "src/word-lanes.h"
 /**
  * \file
  * Definitions and convenience functions for working with unicode.
@@ -160,6 +161,42 @@ class V8_EXPORT_PRIVATE Utf8 {
   static const unsigned kMax16BitCodeUnitSize  = 3;
   static inline uchar ValueOf(const byte* str, size_t length, size_t* cursor);
 
+  // Returns the length of the longest prefix of the given bytes that is
+  // ASCII, i.e. needs no decoding. Aligned input is checked a word at a time.
+  static inline size_t NonAsciiStart(const byte* chars, size_t length) {
+    const byte* start = chars;
+    const byte* limit = chars + length;
+
+    if (length >= sizeof(uintptr_t)) {
+      // Check unaligned bytes.
+      while (!v8::internal::IsAligned(reinterpret_cast<intptr_t>(chars),
+                                      sizeof(uintptr_t))) {
+        if (*chars > kMaxOneByteChar) return chars - start;
+        ++chars;
+      }
+      // Check aligned words, two at a time while that's possible. The exact
+      // position of a non-ASCII byte is left to the byte loop below.
+      while (chars + 2 * sizeof(uintptr_t) <= limit) {
+        const uintptr_t* words = reinterpret_cast<const uintptr_t*>(chars);
+        if ((words[0] | words[1]) & v8::internal::kAsciiMask) break;
+        chars += 2 * sizeof(uintptr_t);
+      }
+      while (chars + sizeof(uintptr_t) <= limit) {
+        if (*reinterpret_cast<const uintptr_t*>(chars) &
+            v8::internal::kAsciiMask) {
+          break;
+        }
+        chars += sizeof(uintptr_t);
+      }
+    }
+    // Check the remaining bytes.
+    while (chars < limit) {
+      if (*chars > kMaxOneByteChar) break;
+      ++chars;
+    }
+    return chars - start;
+  }
+
   typedef uint32_t Utf8IncrementalBuffer;
   static uchar ValueOfIncremental(byte next_byte, size_t* cursor, State* state,
                                   Utf8IncrementalBuffer* buffer);
@@ -21,6 +21,7 @@
 #include "src/base/v8-fallthrough.h"
 #include "src/globals.h"
 #include "src/vector.h"
+#include "src/word-lanes.h"
 #include "src/zone/zone.h"
 
 #if defined(V8_OS_AIX)
@@ -715,6 +716,20 @@ inline int CompareCharsUnsigned(const lchar* lhs, const rchar* rhs,
     // strings on little-endian systems.
     return memcmp(lhs, rhs, chars);
   }
+  if (sizeof(*lhs) == sizeof(*rhs)) {
+    // Skip the common prefix a word at a time. Whether two words are equal
+    // does not depend on the byte order.
+    const size_t kCharsPerWord = sizeof(uintptr_t) / sizeof(*lhs);
+    while (static_cast<size_t>(limit - lhs) >= kCharsPerWord) {
+      uintptr_t lhs_word;
+      uintptr_t rhs_word;
+      memcpy(&lhs_word, lhs, sizeof(lhs_word));
+      memcpy(&rhs_word, rhs, sizeof(rhs_word));
+      if (lhs_word != rhs_word) break;
+      lhs += kCharsPerWord;
+      rhs += kCharsPerWord;
+    }
+  }
   while (lhs < limit) {
     int r = static_cast<int>(*lhs) - static_cast<int>(*rhs);
     if (r != 0) return r;
@@ -724,6 +739,55 @@ inline int CompareCharsUnsigned(const lchar* lhs, const rchar* rhs,
   return 0;
 }
 
+// Returns true iff the 8bit chars |lhs| equal the 16bit chars |rhs|. Four
+// 8bit chars at a time are zero-extended into a 64-bit word, which then has
+// the same layout as four 16bit chars in either byte order.
+inline bool CompareCharsEqualWidening(const uint8_t* lhs, const uint16_t* rhs,
+                                      size_t chars) {
+  const uint64_t kLow16Bits = V8_2PART_UINT64_C(0x0000FFFF, 0000FFFF);
+  const uint64_t kLow8Bits = V8_2PART_UINT64_C(0x00FF00FF, 00FF00FF);
+  const uint8_t* limit = lhs + chars;
+  while (limit - lhs >= 4) {
+    uint32_t narrow;
+    uint64_t wide;
+    memcpy(&narrow, lhs, sizeof(narrow));
+    memcpy(&wide, rhs, sizeof(wide));
+    uint64_t widened = narrow;
+    widened = (widened | (widened << 16)) & kLow16Bits;
+    widened = (widened | (widened << 8)) & kLow8Bits;
+    if (widened != wide) return false;
+    lhs += 4;
+    rhs += 4;
+  }
+  while (lhs < limit) {
+    if (*lhs != *rhs) return false;
+    ++lhs;
+    ++rhs;
+  }
+  return true;
+}
+
+// Returns true iff the given 8bit/16bit chars are equal. Unlike CompareChars
+// this does not need the order of the first difference, so chars of equal
+// width are compared with memcmp, which libc vectorizes.
+template <typename lchar, typename rchar>
+inline bool CompareCharsEqual(const lchar* lhs, const rchar* rhs,
+                              size_t chars) {
+  DCHECK_LE(sizeof(lchar), 2);
+  DCHECK_LE(sizeof(rchar), 2);
+  if (sizeof(lchar) == sizeof(rchar)) {
+    return memcmp(lhs, rhs, chars * sizeof(lchar)) == 0;
+  }
+  if (sizeof(lchar) == 1) {
+    return CompareCharsEqualWidening(reinterpret_cast<const uint8_t*>(lhs),
+                                     reinterpret_cast<const uint16_t*>(rhs),
+                                     chars);
+  }
+  return CompareCharsEqualWidening(reinterpret_cast<const uint8_t*>(rhs),
+                                   reinterpret_cast<const uint16_t*>(lhs),
+                                   chars);
+}
+
 template <typename lchar, typename rchar>
 inline int CompareChars(const lchar* lhs, const rchar* rhs, size_t chars) {
   DCHECK_LE(sizeof(lchar), 2);
@@ -751,6 +815,39 @@ inline int CompareChars(const lchar* lhs, const rchar* rhs, size_t chars) {
   }
 }
 
+// Returns the length of the longest prefix of the given characters that a
+// JSON string can contain verbatim, i.e. without '"', '\\' or control
+// characters. Aligned input is checked a word at a time.
+inline int JsonStringVerbatimPrefix(const uint8_t* chars, int length) {
+  const uint8_t* start = chars;
+  const uint8_t* limit = chars + length;
+
+  if (length >= static_cast<int>(sizeof(uintptr_t))) {
+    // Check unaligned bytes.
+    while (!IsAligned(reinterpret_cast<intptr_t>(chars), sizeof(uintptr_t))) {
+      if (*chars == '"' || *chars == '\\' || *chars < 0x20) {
+        return static_cast<int>(chars - start);
+      }
+      ++chars;
+    }
+    // Check aligned words. The exact position is left to the byte loop below.
+    while (chars + sizeof(uintptr_t) <= limit) {
+      uintptr_t word = *reinterpret_cast<const uintptr_t*>(chars);
+      if (HasByte(word, '"') || HasByte(word, '\\') ||
+          HasByteLessThan(word, 0x20)) {
+        break;
+      }
+      chars += sizeof(uintptr_t);
+    }
+  }
+  // Check the remaining bytes.
+  while (chars < limit) {
+    if (*chars == '"' || *chars == '\\' || *chars < 0x20) break;
+    ++chars;
+  }
+  return static_cast<int>(chars - start);
+}
+
 
 // Calculate 10^exponent.
 inline int TenToThe(int exponent) {
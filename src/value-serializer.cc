@@ -32,6 +32,7 @@ namespace internal {
 // Version 12: regexp and string objects share normal string encoding
 // Version 13: host objects have an explicit tag (rather than handling all
 //             unknown tags)
+// Version 14: objects written against a shape and packed double arrays
 //
 // WARNING: Increasing this value is a change which cannot safely be rolled
 // back without breaking compatibility with data stored on disk. It is
@@ -40,7 +41,7 @@ namespace internal {
 //
 // Recent changes are routinely reverted in preparation for branch, and this
 // has been the cause of at least one bug in the past.
-static const uint32_t kLatestVersion = 13;
+static const uint32_t kLatestVersion = 14;
 static_assert(kLatestVersion == v8::CurrentValueSerializerFormatVersion(),
               "Exported format version must match latest version.");
 
@@ -105,6 +106,16 @@ enum class SerializationTag : uint8_t {
   kBeginDenseJSArray = 'A',
   // End of a dense JS array. numProperties:uint32_t length:uint32_t
   kEndDenseJSArray = '$',
+  // Beginning of a dense JS array of doubles. length:uint32_t, then |length|
+  // raw doubles in host byte order, then properties as key/value pairs,
+  // ending with kEndDenseJSArray.
+  kBeginPackedDoubleJSArray = 'p',
+  // JS object with the property names of a shape. shapeID:uint32_t
+  // If shapeID is the number of shapes read so far, it defines a new shape:
+  // numProperties:uint32_t, then that many strings.
+  // Followed by one value per property, or kTheHole if the property was
+  // removed while serializing.
+  kShapedJSObject = 'j',
   // Date. millisSinceEpoch:double
   kDate = 'D',
   // Boolean object. No data.
@@ -186,7 +197,8 @@ ValueSerializer::ValueSerializer(Isolate* isolate,
       zone_(isolate->allocator(), ZONE_NAME),
       id_map_(isolate->heap(), ZoneAllocationPolicy(&zone_)),
       array_buffer_transfer_map_(isolate->heap(),
-                                 ZoneAllocationPolicy(&zone_)) {}
+                                 ZoneAllocationPolicy(&zone_)),
+      shape_map_(isolate->heap(), ZoneAllocationPolicy(&zone_)) {}
 
 ValueSerializer::~ValueSerializer() {
   if (buffer_) {
@@ -207,6 +219,10 @@ void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
   treat_array_buffer_views_as_host_objects_ = mode;
 }
 
+void ValueSerializer::SetUseCompactEncoding(bool mode) {
+  use_compact_encoding_ = mode;
+}
+
 void ValueSerializer::WriteTag(SerializationTag tag) {
   uint8_t raw_tag = static_cast<uint8_t>(tag);
   WriteRawBytes(&raw_tag, sizeof(raw_tag));
@@ -525,11 +541,19 @@ Maybe<bool> ValueSerializer::WriteJSReceiver(Handle<JSReceiver> receiver) {
   return Nothing<bool>();
 }
 
+// Whether WriteJSObject writes the property of the given descriptor. These
+// properties, in descriptor order, make up the shape of an object.
+static bool IsShapeProperty(DescriptorArray* descriptors, int descriptor) {
+  return descriptors->GetKey(descriptor)->IsString() &&
+         !descriptors->GetDetails(descriptor).IsDontEnum();
+}
+
 Maybe<bool> ValueSerializer::WriteJSObject(Handle<JSObject> object) {
   DCHECK_GT(object->map()->instance_type(), LAST_CUSTOM_ELEMENTS_RECEIVER);
   const bool can_serialize_fast =
       object->HasFastProperties() && object->elements()->length() == 0;
   if (!can_serialize_fast) return WriteJSObjectSlow(object);
+  if (use_compact_encoding_) return WriteShapedJSObject(object);
 
   Handle<Map> map(object->map(), isolate_);
   WriteTag(SerializationTag::kBeginJSObject);
@@ -545,7 +569,7 @@ Maybe<bool> ValueSerializer::WriteJSObject(Handle<JSObject> object) {
     if (details.IsDontEnum()) continue;
 
     Handle<Object> value;
-    if (V8_LIKELY(!map_changed)) map_changed = *map == object->map();
+    if (V8_LIKELY(!map_changed)) map_changed = *map != object->map();
     if (V8_LIKELY(!map_changed && details.location() == kField)) {
       DCHECK_EQ(kData, details.kind());
       FieldIndex field_index = FieldIndex::ForDescriptor(*map, i);
@@ -572,6 +596,57 @@ Maybe<bool> ValueSerializer::WriteJSObject(Handle<JSObject> object) {
   return ThrowIfOutOfMemory();
 }
 
+Maybe<bool> ValueSerializer::WriteShapedJSObject(Handle<JSObject> object) {
+  Handle<Map> map(object->map(), isolate_);
+  WriteTag(SerializationTag::kShapedJSObject);
+
+  // Objects with the same map share a shape, which is written only once.
+  uint32_t* shape_map_entry = shape_map_.Get(map);
+  if (uint32_t shape_id = *shape_map_entry) {
+    WriteVarint(shape_id - 1);
+  } else {
+    *shape_map_entry = next_shape_id_ + 1;
+    WriteVarint(next_shape_id_++);
+    uint32_t num_properties = 0;
+    for (int i = 0; i < map->NumberOfOwnDescriptors(); i++) {
+      if (IsShapeProperty(map->instance_descriptors(), i)) num_properties++;
+    }
+    WriteVarint(num_properties);
+    for (int i = 0; i < map->NumberOfOwnDescriptors(); i++) {
+      if (!IsShapeProperty(map->instance_descriptors(), i)) continue;
+      WriteString(handle(String::cast(map->instance_descriptors()->GetKey(i)),
+                         isolate_));
+    }
+  }
+
+  // Write the values like WriteJSObject does, but without the keys.
+  bool map_changed = false;
+  for (int i = 0; i < map->NumberOfOwnDescriptors(); i++) {
+    if (!IsShapeProperty(map->instance_descriptors(), i)) continue;
+    PropertyDetails details = map->instance_descriptors()->GetDetails(i);
+
+    Handle<Object> value;
+    if (V8_LIKELY(!map_changed)) map_changed = *map != object->map();
+    if (V8_LIKELY(!map_changed && details.location() == kField)) {
+      DCHECK_EQ(kData, details.kind());
+      FieldIndex field_index = FieldIndex::ForDescriptor(*map, i);
+      value = JSObject::FastPropertyAt(object, details.representation(),
+                                       field_index);
+    } else {
+      Handle<Name> key(map->instance_descriptors()->GetKey(i), isolate_);
+      LookupIterator it(isolate_, object, key, LookupIterator::OWN);
+      if (!it.IsFound()) {
+        WriteTag(SerializationTag::kTheHole);
+        continue;
+      }
+      if (!Object::GetProperty(&it).ToHandle(&value)) return Nothing<bool>();
+    }
+
+    if (!WriteObject(value).FromMaybe(false)) return Nothing<bool>();
+  }
+  return ThrowIfOutOfMemory();
+}
+
 Maybe<bool> ValueSerializer::WriteJSObjectSlow(Handle<JSObject> object) {
   WriteTag(SerializationTag::kBeginJSObject);
   Handle<FixedArray> keys;
@@ -603,10 +678,21 @@ Maybe<bool> ValueSerializer::WriteJSArray(Handle<JSArray> array) {
 
   if (should_serialize_densely) {
     DCHECK_LE(length, static_cast<uint32_t>(FixedArray::kMaxLength));
-    WriteTag(SerializationTag::kBeginDenseJSArray);
-    WriteVarint<uint32_t>(length);
     uint32_t i = 0;
 
+    if (use_compact_encoding_ &&
+        array->GetElementsKind() == PACKED_DOUBLE_ELEMENTS && length > 0) {
+      // Packed doubles have no holes, so they can be copied as they are.
+      WriteTag(SerializationTag::kBeginPackedDoubleJSArray);
+      WriteVarint<uint32_t>(length);
+      WriteRawBytes(FixedDoubleArray::cast(array->elements())->data_start(),
+                    length * sizeof(double));
+      i = length;
+    } else {
+      WriteTag(SerializationTag::kBeginDenseJSArray);
+      WriteVarint<uint32_t>(length);
+    }
+
     // Fast paths. Note that PACKED_ELEMENTS in particular can bail due to the
     // structure of the elements changing.
     switch (array->GetElementsKind()) {
@@ -985,10 +1071,13 @@ ValueDeserializer::ValueDeserializer(Isolate* isolate,
       end_(data.start() + data.length()),
       pretenure_(data.length() > kPretenureThreshold ? TENURED : NOT_TENURED),
       id_map_(isolate->global_handles()->Create(
+          isolate_->heap()->empty_fixed_array())),
+      shapes_(isolate->global_handles()->Create(
           isolate_->heap()->empty_fixed_array())) {}
 
 ValueDeserializer::~ValueDeserializer() {
   GlobalHandles::Destroy(Handle<Object>::cast(id_map_).location());
+  GlobalHandles::Destroy(Handle<Object>::cast(shapes_).location());
 
   Handle<Object> transfer_map_handle;
   if (array_buffer_transfer_map_.ToHandle(&transfer_map_handle)) {
@@ -1201,6 +1290,12 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
       return ReadSparseJSArray();
     case SerializationTag::kBeginDenseJSArray:
       return ReadDenseJSArray();
+    case SerializationTag::kBeginPackedDoubleJSArray:
+      if (version_ >= 14) return ReadPackedDoubleJSArray();
+      break;
+    case SerializationTag::kShapedJSObject:
+      if (version_ >= 14) return ReadShapedJSObject();
+      break;
     case SerializationTag::kDate:
       return ReadJSDate();
     case SerializationTag::kTrueObject:
@@ -1235,14 +1330,15 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
     case SerializationTag::kHostObject:
       return ReadHostObject();
     default:
-      // Before there was an explicit tag for host objects, all unknown tags
-      // were delegated to the host.
-      if (version_ < 13) {
-        position_--;
-        return ReadHostObject();
-      }
-      return MaybeHandle<Object>();
+      break;
+  }
+  // Before there was an explicit tag for host objects, all unknown tags
+  // were delegated to the host.
+  if (version_ < 13) {
+    position_--;
+    return ReadHostObject();
   }
+  return MaybeHandle<Object>();
 }
 
 MaybeHandle<String> ValueDeserializer::ReadString() {
@@ -1471,6 +1567,53 @@ MaybeHandle<JSArray> ValueDeserializer::ReadDenseJSArray() {
   return scope.CloseAndEscape(array);
 }
 
+MaybeHandle<JSArray> ValueDeserializer::ReadPackedDoubleJSArray() {
+  // If we are at the end of the stack, abort. This function may recurse.
+  STACK_CHECK(isolate_, MaybeHandle<JSArray>());
+
+  uint32_t length;
+  if (!ReadVarint<uint32_t>().To(&length) || length == 0 ||
+      length > static_cast<uint32_t>(FixedDoubleArray::kMaxLength) ||
+      length > static_cast<size_t>(end_ - position_) / sizeof(double)) {
+    return MaybeHandle<JSArray>();
+  }
+
+  uint32_t id = next_id_++;
+  HandleScope scope(isolate_);
+  Handle<JSArray> array = isolate_->factory()->NewJSArray(
+      PACKED_DOUBLE_ELEMENTS, length, length, DONT_INITIALIZE_ARRAY_ELEMENTS,
+      pretenure_);
+  AddObjectWithID(id, array);
+
+  // Copy the elements in one go, then canonicalize NaNs so that none of them
+  // can be mistaken for the hole.
+  {
+    DisallowHeapAllocation no_gc;
+    double* elements = FixedDoubleArray::cast(array->elements())->data_start();
+    memcpy(elements, position_, length * sizeof(double));
+    position_ += length * sizeof(double);
+    for (uint32_t i = 0; i < length; i++) {
+      if (std::isnan(elements[i])) {
+        elements[i] = std::numeric_limits<double>::quiet_NaN();
+      }
+    }
+  }
+
+  uint32_t num_properties;
+  uint32_t expected_num_properties;
+  uint32_t expected_length;
+  if (!ReadJSObjectProperties(array, SerializationTag::kEndDenseJSArray, false)
+           .To(&num_properties) ||
+      !ReadVarint<uint32_t>().To(&expected_num_properties) ||
+      !ReadVarint<uint32_t>().To(&expected_length) ||
+      num_properties != expected_num_properties || length != expected_length) {
+    return MaybeHandle<JSArray>();
+  }
+
+  DCHECK(HasObjectWithID(id));
+  return scope.CloseAndEscape(array);
+}
+
 MaybeHandle<JSDate> ValueDeserializer::ReadJSDate() {
   double value;
   if (!ReadDouble().To(&value)) return MaybeHandle<JSDate>();
@@ -2006,6 +2149,135 @@ Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
   }
 }
 
+// Stores the values of all properties of a shape into an object at once, using
+// the map an earlier object of that shape ended up with. Returns false without
+// touching the object if that map can't hold the values.
+static bool CommitShapedProperties(
+    Isolate* isolate, Handle<JSObject> object, Handle<Map> map,
+    Handle<FixedArray> keys, const std::vector<Handle<Object>>& values) {
+  if (map->is_deprecated() && !Map::TryUpdate(map).ToHandle(&map)) {
+    return false;
+  }
+  if (map->is_dictionary_map() ||
+      map->NumberOfOwnDescriptors() != keys->length() ||
+      map->GetInObjectProperties() != object->map()->GetInObjectProperties()) {
+    return false;
+  }
+  for (int i = 0; i < keys->length(); i++) {
+    PropertyDetails details = map->instance_descriptors()->GetDetails(i);
+    if (map->instance_descriptors()->GetKey(i) != keys->get(i) ||
+        details.location() != kField || details.kind() != kData ||
+        details.attributes() != NONE) {
+      return false;
+    }
+    if (!values[i]->FitsRepresentation(details.representation())) {
+      return false;
+    }
+  }
+  // Like ReadJSObjectProperties, generalize field types where necessary.
+  for (int i = 0; i < keys->length(); i++) {
+    PropertyDetails details = map->instance_descriptors()->GetDetails(i);
+    Representation representation = details.representation();
+    if (representation.IsHeapObject() &&
+        !map->instance_descriptors()->GetFieldType(i)->NowContains(
+            values[i])) {
+      Handle<FieldType> value_type =
+          values[i]->OptimalType(isolate, representation);
+      Map::GeneralizeField(map, i, details.constness(), representation,
+                           value_type);
+    }
+  }
+  CommitProperties(object, map, values);
+  return true;
+}
+
+MaybeHandle<JSObject> ValueDeserializer::ReadShapedJSObject() {
+  // If we are at the end of the stack, abort. This function may recurse.
+  STACK_CHECK(isolate_, MaybeHandle<JSObject>());
+
+  uint32_t shape_id;
+  if (!ReadVarint<uint32_t>().To(&shape_id) || shape_id > next_shape_id_) {
+    return MaybeHandle<JSObject>();
+  }
+
+  uint32_t id = next_id_++;
+  HandleScope scope(isolate_);
+  Handle<FixedArray> keys;
+  if (shape_id == next_shape_id_) {
+    // Each property name takes at least one byte to encode.
+    uint32_t num_properties;
+    if (!ReadVarint<uint32_t>().To(&num_properties) ||
+        num_properties > static_cast<uint32_t>(FixedArray::kMaxLength) ||
+        num_properties > static_cast<size_t>(end_ - position_)) {
+      return MaybeHandle<JSObject>();
+    }
+    keys = isolate_->factory()->NewFixedArray(num_properties);
+    for (uint32_t i = 0; i < num_properties; i++) {
+      Handle<String> key;
+      if (!ReadString().ToHandle(&key)) return MaybeHandle<JSObject>();
+      keys->set(i, *isolate_->factory()->InternalizeString(key));
+    }
+    Handle<FixedArray> new_shapes =
+        FixedArray::SetAndGrow(shapes_, 2 * shape_id + 1, keys);
+    if (!new_shapes.is_identical_to(shapes_)) {
+      GlobalHandles::Destroy(Handle<Object>::cast(shapes_).location());
+      shapes_ = isolate_->global_handles()->Create(*new_shapes);
+    }
+    next_shape_id_++;
+  } else {
+    keys = handle(FixedArray::cast(shapes_->get(2 * shape_id + 1)), isolate_);
+  }
+
+  Handle<JSObject> object =
+      isolate_->factory()->NewJSObject(isolate_->object_function(), pretenure_);
+  AddObjectWithID(id, object);
+
+  std::vector<Handle<Object>> values;
+  values.reserve(keys->length());
+  bool has_holes = false;
+  for (int i = 0; i < keys->length(); i++) {
+    SerializationTag tag;
+    if (PeekTag().To(&tag) && tag == SerializationTag::kTheHole) {
+      ConsumeTag(SerializationTag::kTheHole);
+      values.push_back(Handle<Object>());
+      has_holes = true;
+      continue;
+    }
+    Handle<Object> value;
+    if (!ReadObject().ToHandle(&value)) return MaybeHandle<JSObject>();
+    values.push_back(value);
+  }
+
+  // Once an object of this shape has been read, later ones can start out
+  // with its map.
+  Object* shape_map = shapes_->get(2 * shape_id);
+  if (!has_holes && shape_map->IsMap() &&
+      CommitShapedProperties(isolate_, object, handle(Map::cast(shape_map)),
+                             keys, values)) {
+    DCHECK(HasObjectWithID(id));
+    return scope.CloseAndEscape(object);
+  }
+
+  for (int i = 0; i < keys->length(); i++) {
+    if (values[i].is_null()) continue;
+    Handle<Name> key(Name::cast(keys->get(i)), isolate_);
+    bool success;
+    LookupIterator it = LookupIterator::PropertyOrElement(
+        isolate_, object, key, &success, LookupIterator::OWN);
+    if (!success ||
+        JSObject::DefineOwnPropertyIgnoreAttributes(&it, values[i], NONE)
+            .is_null()) {
+      return MaybeHandle<JSObject>();
+    }
+  }
+  if (!has_holes && !object->map()->is_dictionary_map()) {
+    shapes_->set(2 * shape_id, object->map());
+  }
+
+  DCHECK(HasObjectWithID(id));
+  return scope.CloseAndEscape(object);
+}
+
 bool ValueDeserializer::HasObjectWithID(uint32_t id) {
   return id < static_cast<unsigned>(id_map_->length()) &&
          !id_map_->get(id)->IsTheHole(isolate_);
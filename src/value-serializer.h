@@ -96,6 +96,16 @@ class ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  /*
+   * Indicate whether to write plain objects as references to shared object
+   * shapes, each of which lists its property names once, and packed double
+   * arrays as raw data. This makes arrays of similar objects smaller and
+   * faster to read, but requires a ValueDeserializer that knows these tags.
+   *
+   * The default is not to use these encodings.
+   */
+  void SetUseCompactEncoding(bool mode);
+
  private:
   // Managing allocations of the internal buffer.
   Maybe<bool> ExpandBuffer(size_t required_capacity);
@@ -121,6 +131,8 @@ class ValueSerializer {
       V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSObject(Handle<JSObject> object) V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSObjectSlow(Handle<JSObject> object) V8_WARN_UNUSED_RESULT;
+  Maybe<bool> WriteShapedJSObject(Handle<JSObject> object)
+      V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSArray(Handle<JSArray> array) V8_WARN_UNUSED_RESULT;
   void WriteJSDate(JSDate* date);
   Maybe<bool> WriteJSValue(Handle<JSValue> value) V8_WARN_UNUSED_RESULT;
@@ -157,6 +169,7 @@ class ValueSerializer {
   Isolate* const isolate_;
   v8::ValueSerializer::Delegate* const delegate_;
   bool treat_array_buffer_views_as_host_objects_ = false;
+  bool use_compact_encoding_ = false;
   uint8_t* buffer_ = nullptr;
   size_t buffer_size_ = 0;
   size_t buffer_capacity_ = 0;
@@ -172,6 +185,10 @@ class ValueSerializer {
   // A similar map, for transferred array buffers.
   IdentityMap<uint32_t, ZoneAllocationPolicy> array_buffer_transfer_map_;
 
+  // A similar map from the maps of objects written as shapes to shape IDs.
+  IdentityMap<uint32_t, ZoneAllocationPolicy> shape_map_;
+  uint32_t next_shape_id_ = 0;
+
   DISALLOW_COPY_AND_ASSIGN(ValueSerializer);
 };
 
@@ -266,6 +283,8 @@ class ValueDeserializer {
   MaybeHandle<JSObject> ReadJSObject() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArray> ReadSparseJSArray() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArray> ReadDenseJSArray() V8_WARN_UNUSED_RESULT;
+  MaybeHandle<JSObject> ReadShapedJSObject() V8_WARN_UNUSED_RESULT;
+  MaybeHandle<JSArray> ReadPackedDoubleJSArray() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSDate> ReadJSDate() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSValue> ReadJSValue(SerializationTag tag) V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSRegExp> ReadJSRegExp() V8_WARN_UNUSED_RESULT;
@@ -302,10 +321,14 @@ class ValueDeserializer {
   PretenureFlag pretenure_;
   uint32_t version_ = 0;
   uint32_t next_id_ = 0;
+  uint32_t next_shape_id_ = 0;
   bool expect_inline_wasm_ = false;
 
   // Always global handles.
   Handle<FixedArray> id_map_;
+  // For each shape, the map objects of that shape end up with (undefined until
+  // one has been read), followed by its property names.
+  Handle<FixedArray> shapes_;
   MaybeHandle<SimpleNumberDictionary> array_buffer_transfer_map_;
 
   DISALLOW_COPY_AND_ASSIGN(ValueDeserializer);
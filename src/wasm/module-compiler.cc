@@ -3263,7 +3263,7 @@ Handle<Script> CreateWasmScript(Isolate* isolate,
   script->set_context_data(isolate->native_context()->debug_context_id());
   script->set_type(Script::TYPE_WASM);
 
-  int hash = StringHasher::HashSequentialString(
+  int hash = StringHasher::HashSequentialStringOneAtATime(
       reinterpret_cast<const char*>(wire_bytes.start()),
       static_cast<int>(wire_bytes.length()), kZeroHashSeed);
 
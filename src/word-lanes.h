@@ -0,0 +1,54 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_WORD_LANES_H_
+#define V8_WORD_LANES_H_
+
+#include "src/globals.h"
+
+namespace v8 {
+namespace internal {
+
+// Word-at-a-time (SWAR) helpers, treating a uintptr_t as a vector of one-byte
+// or uc16 lanes. They let string code test several characters at a time
+// without relying on target specific SIMD instructions. Callers are expected
+// to load aligned words only and to find the exact position of a hit with a
+// character loop.
+
+const uintptr_t kOneInEveryByte = kUintptrAllBitsSet / 0xFF;
+const uintptr_t kAsciiMask = kOneInEveryByte << 7;
+
+const uintptr_t kOneInEveryUc16 = kUintptrAllBitsSet / 0xFFFF;
+const uintptr_t kUc16HighBits = kOneInEveryUc16 << 15;
+const uintptr_t kUc16NonAsciiMask = kOneInEveryUc16 * 0xFF80;
+const int kUc16PerWord = sizeof(uintptr_t) / sizeof(uc16);
+
+// Returns true if any byte of w is less than n. Requires n <= 0x80.
+inline bool HasByteLessThan(uintptr_t w, uint8_t n) {
+  return ((w - kOneInEveryByte * n) & ~w & kAsciiMask) != 0;
+}
+
+// Returns true if any byte of w equals b.
+inline bool HasByte(uintptr_t w, uint8_t b) {
+  return HasByteLessThan(w ^ (kOneInEveryByte * b), 1);
+}
+
+// Returns true if any uc16 lane of w equals c.
+inline bool HasUc16(uintptr_t w, uc16 c) {
+  uintptr_t x = w ^ (kOneInEveryUc16 * c);
+  return ((x - kOneInEveryUc16) & ~x & kUc16HighBits) != 0;
+}
+
+// Returns a word that has the high bit of every uc16 lane of w that equals c
+// set, and no other bit. Unlike HasUc16 this is exact, so masks of different
+// words can be combined.
+inline uintptr_t MatchUc16(uintptr_t w, uc16 c) {
+  uintptr_t x = w ^ (kOneInEveryUc16 * c);
+  return ~(((x & ~kUc16HighBits) + ~kUc16HighBits) | x) & kUc16HighBits;
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_WORD_LANES_H_
@@ -17,13 +17,18 @@ namespace internal {
 
 AccountingAllocator::AccountingAllocator() : unused_segments_mutex_() {
   static const size_t kDefaultBucketMaxSize = 5;
+  static const size_t kNumberDefaultBuckets =
+      1 + kDefaultMaxSegmentSizePower - kMinSegmentSizePower;
 
   memory_pressure_level_.SetValue(MemoryPressureLevel::kNone);
   std::fill(unused_segments_heads_, unused_segments_heads_ + kNumberBuckets,
             nullptr);
   std::fill(unused_segments_sizes_, unused_segments_sizes_ + kNumberBuckets, 0);
   std::fill(unused_segments_max_sizes_,
-            unused_segments_max_sizes_ + kNumberBuckets, kDefaultBucketMaxSize);
+            unused_segments_max_sizes_ + kNumberDefaultBuckets,
+            kDefaultBucketMaxSize);
+  std::fill(unused_segments_max_sizes_ + kNumberDefaultBuckets,
+            unused_segments_max_sizes_ + kNumberBuckets, 0);
 }
 
 AccountingAllocator::~AccountingAllocator() { ClearPool(); }
@@ -64,7 +69,7 @@ void AccountingAllocator::ConfigureSegmentPool(const size_t max_pool_size) {
     if (total_size + (size_t(1) << (power + kMinSegmentSizePower)) <=
         max_pool_size) {
       unused_segments_max_sizes_[power] = fits_fully + 1;
-      total_size += size_t(1) << power;
+      total_size += size_t(1) << (power + kMinSegmentSizePower);
     } else {
       unused_segments_max_sizes_[power] = fits_fully;
     }
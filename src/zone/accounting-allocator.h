@@ -22,6 +22,11 @@ namespace internal {
 class V8_EXPORT_PRIVATE AccountingAllocator {
  public:
   static const size_t kMaxPoolSize = 8ul * KB;
+  // A pool of this size holds one segment of every pooled size, so that a zone
+  // which grows to the maximum segment size (e.g. the zone of a large parse)
+  // can be recycled by the next one. Embedders opt in through
+  // ResourceConstraints::set_max_zone_pool_size().
+  static const size_t kPoolSizeForMaximumSegments = 2ul * MB;
 
   AccountingAllocator();
   virtual ~AccountingAllocator();
@@ -49,9 +54,15 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
 
  private:
   FRIEND_TEST(Zone, SegmentPoolConstraints);
+  FRIEND_TEST(Zone, SegmentPoolHoldsMaximumSegments);
 
+  // Segments between Zone::kMinimumSegmentSize and Zone::kMaximumSegmentSize
+  // are pooled.
   static const size_t kMinSegmentSizePower = 13;
-  static const size_t kMaxSegmentSizePower = 18;
+  static const size_t kMaxSegmentSizePower = 20;
+  // Segments above this size are only pooled when the pool is configured to
+  // hold them.
+  static const size_t kDefaultMaxSegmentSizePower = 18;
 
   STATIC_ASSERT(kMinSegmentSizePower <= kMaxSegmentSizePower);
 
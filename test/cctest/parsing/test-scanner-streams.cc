@@ -344,6 +344,36 @@ void TestCharacterStreams(const char* one_byte_source, unsigned length,
                         end);
   }
 
+  // 1-byte sliced i::String, over a sequential and an external parent.
+  {
+    std::unique_ptr<char[]> padded(new char[length + 4]);
+    padded[0] = padded[1] = '<';
+    i::MemCopy(padded.get() + 2, one_byte_source, length);
+    padded[length + 2] = padded[length + 3] = '>';
+    i::Handle<i::String> seq_parent =
+        factory
+            ->NewStringFromOneByte(i::OneByteVector(
+                padded.get(), static_cast<int>(length + 4)))
+            .ToHandleChecked();
+    i::Handle<i::String> seq_slice =
+        factory->NewProperSubString(seq_parent, 2, length + 2);
+    std::unique_ptr<i::Utf16CharacterStream> seq_slice_stream(
+        i::ScannerStream::For(seq_slice, start, end));
+    TestCharacterStream(one_byte_source, seq_slice_stream.get(), length, start,
+                        end);
+
+    TestExternalOneByteResource padded_resource(padded.get(), length + 4);
+    i::Handle<i::String> ext_parent(
+        factory->NewExternalStringFromOneByte(&padded_resource)
+            .ToHandleChecked());
+    i::Handle<i::String> ext_slice =
+        factory->NewProperSubString(ext_parent, 2, length + 2);
+    std::unique_ptr<i::Utf16CharacterStream> ext_slice_stream(
+        i::ScannerStream::For(ext_slice, start, end));
+    TestCharacterStream(one_byte_source, ext_slice_stream.get(), length, start,
+                        end);
+  }
+
   // 2-byte generic i::String
   {
     i::Handle<i::String> two_byte_string =
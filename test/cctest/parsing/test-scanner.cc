@@ -10,6 +10,7 @@
 #include "src/parsing/scanner-character-streams.h"
 #include "src/parsing/scanner.h"
 #include "src/unicode-cache.h"
+#include "src/zone/zone.h"
 #include "test/cctest/cctest.h"
 
 namespace v8 {
@@ -131,5 +132,25 @@ TEST(ContextualKeywordTokens) {
   CHECK_TOK(Token::UNINITIALIZED, scanner->current_contextual_token());
 }
 
+TEST(LongCommentsAndStrings) {
+  // Comments, whitespace runs and string literals which span several stream
+  // buffers, so that their bodies are skipped or copied in bulk.
+  std::string body;
+  for (int i = 0; i < 1500; i++) body += static_cast<char>('a' + i % 26);
+  body[700] = '"';
+  body[1000] = '*';
+  std::string src = "/* " + body + " */ x" + std::string(600, ' ') + "// " +
+                    body + "\n'" + body + "' /* \u2028 */ y";
+
+  auto scanner = make_scanner(src.c_str());
+  CHECK_TOK(Token::IDENTIFIER, scanner->Next());
+  CHECK_TOK(Token::STRING, scanner->Next());
+  Zone zone(CcTest::i_isolate()->allocator(), ZONE_NAME);
+  CHECK_EQ(body, std::string(scanner->CurrentLiteralAsCString(&zone)));
+  CHECK_TOK(Token::IDENTIFIER, scanner->Next());
+  CHECK_EQ(static_cast<int>(src.length()) - 1, scanner->location().beg_pos);
+  CHECK_TOK(Token::EOS, scanner->Next());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -15521,7 +15521,7 @@ void RunBeforeGC(v8::Isolate* isolate, v8::GCType type,
 // * interrupting with GC
 // * turn the subject string from one-byte internal to two-byte external string
 // * force termination
-TEST(RegExpInterruption) {
+static void RunRegExpInterruption() {
   LocalContext env;
   v8::HandleScope scope(env->GetIsolate());
 
@@ -15549,6 +15549,21 @@ TEST(RegExpInterruption) {
   i::DeleteArray(uc16_content);
 }
 
+// Regexps start out in the bytecode interpreter, which has to handle the
+// interrupts as well as native code.
+TEST(RegExpInterruption) { RunRegExpInterruption(); }
+
+TEST(RegExpInterruptionInInterpreter) {
+  i::FLAG_regexp_tier_up = true;
+  i::FLAG_regexp_tier_up_ticks = 100;
+  RunRegExpInterruption();
+}
+
+TEST(RegExpInterruptionInNativeCode) {
+  i::FLAG_regexp_tier_up = false;
+  RunRegExpInterruption();
+}
+
 #endif  // V8_INTERPRETED_REGEXP
 
 
@@ -22931,6 +22946,108 @@ THREADED_TEST(JSONParseArray) {
                      i::PACKED_ELEMENTS);
 }
 
+// Feeds |text| to |parser| in chunks of |chunk_size| bytes.
+static bool FeedJSONInChunks(Local<Context> context,
+                             v8::JSON::StreamingParser* parser,
+                             const char* text, size_t chunk_size) {
+  size_t length = strlen(text);
+  for (size_t i = 0; i < length; i += chunk_size) {
+    size_t size = std::min(chunk_size, length - i);
+    if (parser->Feed(context, reinterpret_cast<const uint8_t*>(text + i), size)
+            .IsNothing()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void CheckJSONStreamingParserError(Local<Context> context,
+                                          v8::JSON::StreamingParser* parser,
+                                          const char* text,
+                                          const char* expected) {
+  v8::TryCatch try_catch(context->GetIsolate());
+  for (size_t chunk_size : {1, 3, 1000}) {
+    if (FeedJSONInChunks(context, parser, text, chunk_size)) {
+      CHECK(parser->Finish(context).IsEmpty());
+    }
+    CHECK(try_catch.HasCaught());
+    v8::String::Utf8Value message(context->GetIsolate(), try_catch.Exception());
+    CHECK_EQ(0, strcmp(expected, *message));
+    try_catch.Reset();
+  }
+}
+
+THREADED_TEST(JSONStreamingParser) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  v8::JSON::StreamingParser parser(isolate);
+  Local<Object> global = context->Global();
+
+  // Members are parsed whatever the chunks split, including the multi-byte
+  // characters. The parser can be reused.
+  const char* text =
+      " {\"a\": [1, 2.5, \"x\"], \"\xC3\xA4\": \"\xF0\x9F\x98\x80\","
+      " \"b\": {\"c\": \"]}\\\",\"}, \"a\": null, \"__proto__\": 1} ";
+  for (size_t chunk_size : {1, 2, 3, 7, 1000}) {
+    CHECK(FeedJSONInChunks(context.local(), &parser, text, chunk_size));
+    Local<Value> obj = parser.Finish(context.local()).ToLocalChecked();
+    global->Set(context.local(), v8_str("obj"), obj).FromJust();
+    ExpectString("JSON.stringify(obj)",
+                 "{\"a\":null,\"\xC3\xA4\":\"\xF0\x9F\x98\x80\","
+                 "\"b\":{\"c\":\"]}\\\",\"},\"__proto__\":1}");
+    ExpectInt32("obj['\\u00e4'].codePointAt(0)", 0x1F600);
+    ExpectTrue("Object.getPrototypeOf(obj) === Object.prototype");
+  }
+
+  // Top-level arrays, empty containers and other values.
+  CHECK(FeedJSONInChunks(context.local(), &parser,
+                         "[[], {}, \"[,\", -1e3, true]", 2));
+  Local<Value> array = parser.Finish(context.local()).ToLocalChecked();
+  global->Set(context.local(), v8_str("array"), array).FromJust();
+  ExpectString("JSON.stringify(array)", "[[],{},\"[,\",-1000,true]");
+  const char* values[] = {"[]", "{}", " \"abc\" ", "12", "null"};
+  for (const char* value : values) {
+    CHECK(FeedJSONInChunks(context.local(), &parser, value, 1));
+    Local<Value> result = parser.Finish(context.local()).ToLocalChecked();
+    global->Set(context.local(), v8_str("result"), result).FromJust();
+    ExpectBoolean(
+        (std::string("JSON.stringify(result) === JSON.stringify(") + value +
+         ")").c_str(),
+        true);
+  }
+
+  // Invalid and incomplete sequences are replaced by U+FFFD.
+  CHECK(FeedJSONInChunks(context.local(), &parser, "\"\xFF\xE2\x82\"", 1));
+  Local<Value> replaced = parser.Finish(context.local()).ToLocalChecked();
+  global->Set(context.local(), v8_str("replaced"), replaced).FromJust();
+  ExpectString("escape(replaced)", "%uFFFD%uFFFD");
+
+  // Errors report positions in the whole text, and the parser starts over
+  // afterwards.
+  CheckJSONStreamingParserError(
+      context.local(), &parser, "[1, 2,]",
+      "SyntaxError: Unexpected token ] in JSON at position 6");
+  CheckJSONStreamingParserError(
+      context.local(), &parser, "[1, [2}]",
+      "SyntaxError: Unexpected token } in JSON at position 6");
+  CheckJSONStreamingParserError(
+      context.local(), &parser, "{\"a\": 1, \"b\"}",
+      "SyntaxError: Unexpected token } in JSON at position 12");
+  CheckJSONStreamingParserError(
+      context.local(), &parser, "{\"a\": 1, 2: 3}",
+      "SyntaxError: Unexpected token 2 in JSON at position 9");
+  CheckJSONStreamingParserError(
+      context.local(), &parser, "[1] 2",
+      "SyntaxError: Unexpected token 2 in JSON at position 4");
+  CheckJSONStreamingParserError(context.local(), &parser, "[1, 2",
+                                "SyntaxError: Unexpected end of JSON input");
+  CheckJSONStreamingParserError(context.local(), &parser, " ",
+                                "SyntaxError: Unexpected end of JSON input");
+  CHECK(FeedJSONInChunks(context.local(), &parser, "[1]", 1));
+  CHECK(parser.Finish(context.local()).ToLocalChecked()->IsArray());
+}
+
 THREADED_TEST(JSONStringifyObject) {
   LocalContext context;
   HandleScope scope(context->GetIsolate());
@@ -25406,6 +25523,88 @@ TEST(StreamingWithHarmonyScopes) {
   delete[] full_source;
 }
 
+namespace {
+
+v8::Global<Module> streaming_module_dependency;
+
+v8::MaybeLocal<Module> StreamingModuleResolveCallback(Local<Context> context,
+                                                      Local<String> specifier,
+                                                      Local<Module> referrer) {
+  CHECK(specifier->StrictEquals(v8_str("dep.js")));
+  return streaming_module_dependency.Get(context->GetIsolate());
+}
+
+v8::MaybeLocal<Module> CompileStreamedModule(Local<Context> context,
+                                             const char** chunks) {
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::ScriptCompiler::StreamedSource source(
+      new TestSourceStream(chunks),
+      v8::ScriptCompiler::StreamedSource::ONE_BYTE);
+  v8::ScriptCompiler::ScriptStreamingTask* task =
+      v8::ScriptCompiler::StartStreamingModule(isolate, &source);
+  task->Run();
+  delete task;
+
+  v8::ScriptOrigin origin(v8_str("http://foo.com/module.js"),
+                          Local<v8::Integer>(), Local<v8::Integer>(),
+                          Local<v8::Boolean>(), Local<v8::Integer>(),
+                          Local<v8::Value>(), Local<v8::Boolean>(),
+                          Local<v8::Boolean>(), True(isolate));
+  char* full_source = TestSourceStream::FullSourceString(chunks);
+  v8::MaybeLocal<Module> module = v8::ScriptCompiler::CompileModule(
+      context, &source, v8_str(full_source), origin);
+  delete[] full_source;
+  return module;
+}
+
+}  // namespace
+
+TEST(StreamingModule) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  v8::TryCatch try_catch(isolate);
+
+  v8::ScriptOrigin dep_origin(v8_str("http://foo.com/dep.js"),
+                              Local<v8::Integer>(), Local<v8::Integer>(),
+                              Local<v8::Boolean>(), Local<v8::Integer>(),
+                              Local<v8::Value>(), Local<v8::Boolean>(),
+                              Local<v8::Boolean>(), True(isolate));
+  v8::ScriptCompiler::Source dep_source(v8_str("export let a = 6;"),
+                                        dep_origin);
+  Local<Module> dep =
+      v8::ScriptCompiler::CompileModule(isolate, &dep_source).ToLocalChecked();
+  streaming_module_dependency.Reset(isolate, dep);
+
+  // Module code is strict, and 'this' is undefined at the top level.
+  const char* chunks[] = {"import {a} from 'dep.js';\n",
+                          "export let b = a * 2 + 1;\n",
+                          "this === undefined ? b : -1;", nullptr};
+  Local<Module> module =
+      CompileStreamedModule(env.local(), chunks).ToLocalChecked();
+  CHECK(!try_catch.HasCaught());
+  CHECK_EQ(1, module->GetModuleRequestsLength());
+  CHECK(module->GetModuleRequest(0)->StrictEquals(v8_str("dep.js")));
+
+  CHECK(module->InstantiateModule(env.local(), StreamingModuleResolveCallback)
+            .FromJust());
+  Local<Value> result = module->Evaluate(env.local()).ToLocalChecked();
+  CHECK_EQ(13, result->Int32Value(env.local()).FromJust());
+  streaming_module_dependency.Reset();
+}
+
+TEST(StreamingModuleWithParseError) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  v8::TryCatch try_catch(isolate);
+
+  // 'await' is reserved in module code, but not in scripts.
+  const char* chunks[] = {"var await = 13;", nullptr};
+  CHECK(CompileStreamedModule(env.local(), chunks).IsEmpty());
+  CHECK(try_catch.HasCaught());
+}
+
 
 TEST(CodeCache) {
   v8::Isolate::CreateParams create_params;
@@ -31,6 +31,7 @@
 #include "src/v8.h"
 
 #include "src/api.h"
+#include "src/compiler-dispatcher/compiler-dispatcher.h"
 #include "src/compiler.h"
 #include "src/disasm.h"
 #include "src/factory.h"
@@ -838,5 +839,56 @@ TEST(DeepEagerCompilation) {
   }
 }
 
+TEST(ParallelCompileTopLevelFunctions) {
+  i::FLAG_always_opt = false;
+  i::FLAG_compiler_dispatcher = true;
+  i::FLAG_parallel_compile_top_level_functions = true;
+  i::FLAG_parallel_compile_min_function_size = 64;
+  CcTest::InitializeVM();
+  LocalContext env;
+  i::Isolate* isolate = CcTest::i_isolate();
+  v8::HandleScope scope(CcTest::isolate());
+  CompileRun(
+      "function big(x) {"
+      "  var result = 0;"
+      "  for (var i = 0; i < x; i++) {"
+      "    result += i * 2;"
+      "    result -= i;"
+      "  }"
+      "  return result;"
+      "}"
+      "function small(x) { return x; }");
+
+  Handle<JSFunction> big = Handle<JSFunction>::cast(v8::Utils::OpenHandle(
+      *v8::Local<v8::Function>::Cast(CompileRun("big"))));
+  Handle<JSFunction> small = Handle<JSFunction>::cast(v8::Utils::OpenHandle(
+      *v8::Local<v8::Function>::Cast(CompileRun("small"))));
+  Handle<SharedFunctionInfo> big_shared(big->shared(), isolate);
+  CHECK(isolate->compiler_dispatcher()->IsEnqueued(big_shared));
+  CHECK(!isolate->compiler_dispatcher()->IsEnqueued(
+      handle(small->shared(), isolate)));
+
+  CHECK_EQ(45, CompileRun("big(10)")->Int32Value(env.local()).FromJust());
+  CHECK(big_shared->is_compiled());
+  CHECK(!isolate->compiler_dispatcher()->IsEnqueued(big_shared));
+
+  // Functions preparsed while lazily compiling their outer function are not
+  // recorded.
+  CompileRun(
+      "function outer() {"
+      "  function inner(x) {"
+      "    var result = 0;"
+      "    for (var i = 0; i < x; i++) result += i * 2;"
+      "    return result;"
+      "  }"
+      "  return inner;"
+      "}"
+      "var inner = outer();");
+  Handle<JSFunction> inner = Handle<JSFunction>::cast(v8::Utils::OpenHandle(
+      *v8::Local<v8::Function>::Cast(CompileRun("inner"))));
+  CHECK(!isolate->compiler_dispatcher()->IsEnqueued(
+      handle(inner->shared(), isolate)));
+}
+
 }  // namespace internal
 }  // namespace v8
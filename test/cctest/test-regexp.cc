@@ -34,10 +34,13 @@
 
 #include "src/api.h"
 #include "src/ast/ast.h"
+#include "src/compilation-cache.h"
 #include "src/char-predicates-inl.h"
 #include "src/objects-inl.h"
 #include "src/ostreams.h"
 #include "src/regexp/jsregexp.h"
+#include "src/regexp/regexp-bytecode-cache.h"
+#include "src/regexp/regexp-linear.h"
 #include "src/regexp/regexp-macro-assembler-irregexp.h"
 #include "src/regexp/regexp-macro-assembler.h"
 #include "src/regexp/regexp-parser.h"
@@ -591,7 +594,8 @@ static RegExpNode* Compile(const char* input, bool multiline, bool unicode,
   Handle<String> sample_subject =
       isolate->factory()->NewStringFromUtf8(CStrVector("")).ToHandleChecked();
   RegExpEngine::Compile(isolate, zone, &compile_data, flags, pattern,
-                        sample_subject, is_one_byte);
+                        sample_subject, is_one_byte,
+                        !RegExpImpl::UsesNativeRegExp());
   return compile_data.node;
 }
 
@@ -1997,6 +2001,204 @@ TEST(UncachedExternalString) {
   ExpectString("external.substring(1).match(re)[1]", "z");
 }
 
+enum LinearSupport { kUnsupported, kSupported, kSupportedAndNested };
+
+static LinearSupport CheckLinear(const char* input,
+                                 JSRegExp::Flags flags = JSRegExp::kNone) {
+  v8::HandleScope scope(CcTest::isolate());
+  Zone zone(CcTest::i_isolate()->allocator(), ZONE_NAME);
+  FlatStringReader reader(CcTest::i_isolate(), CStrVector(input));
+  RegExpCompileData result;
+  CHECK(v8::internal::RegExpParser::ParseRegExp(CcTest::i_isolate(), &zone,
+                                                &reader, flags, &result));
+  bool has_nested_quantifiers = false;
+  Handle<ByteArray> program;
+  if (!RegExpLinear::Compile(CcTest::i_isolate(), &zone, result.tree,
+                             &has_nested_quantifiers)
+           .ToHandle(&program)) {
+    return kUnsupported;
+  }
+  return has_nested_quantifiers ? kSupportedAndNested : kSupported;
+}
+
+TEST(RegExpLinearSupport) {
+  CcTest::InitializeVM();
+  CHECK_EQ(kSupported, CheckLinear("abc"));
+  CHECK_EQ(kSupported, CheckLinear("^(a|b)*?c{2,5}[^d-f]\\b$"));
+  CHECK_EQ(kSupported, CheckLinear("(?:a+)?(b*)"));
+  CHECK_EQ(kSupported, CheckLinear("(a?){3}"));
+  CHECK_EQ(kSupported, CheckLinear("(.)\\w+", JSRegExp::kDotAll));
+  CHECK_EQ(kSupportedAndNested, CheckLinear("(a+)+b"));
+  CHECK_EQ(kSupportedAndNested, CheckLinear("^(\\w+\\s?)*$"));
+  CHECK_EQ(kSupported, CheckLinear("(a{2,3})+"));
+
+  CHECK_EQ(kUnsupported, CheckLinear("(a)\\1"));
+  CHECK_EQ(kUnsupported, CheckLinear("a(?=b)"));
+  CHECK_EQ(kUnsupported, CheckLinear("abc", JSRegExp::kIgnoreCase));
+  CHECK_EQ(kUnsupported, CheckLinear("abc", JSRegExp::kUnicode));
+  // Optional iterations that can match the empty string.
+  CHECK_EQ(kUnsupported, CheckLinear("(a?)*"));
+  CHECK_EQ(kUnsupported, CheckLinear("(?:a|)+"));
+  CHECK_EQ(kUnsupported, CheckLinear("(b*){0,3}"));
+  // Too large once the bounded quantifiers are unrolled.
+  CHECK_EQ(kUnsupported, CheckLinear("(?:a{1000}){1000}"));
+}
+
+static Handle<JSRegExp> CompileRunRegExp(const char* source) {
+  return Handle<JSRegExp>::cast(v8::Utils::OpenHandle(*CompileRun(source)));
+}
+
+TEST(RegExpTierUp) {
+  FLAG_regexp_tier_up = true;
+  FLAG_regexp_tier_up_ticks = 2;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext env;
+  bool is_native = RegExpImpl::UsesNativeRegExp();
+  int index = JSRegExp::code_index(true);
+
+  Handle<JSRegExp> re = CompileRunRegExp("var re = /(a)b|c/; re");
+  CHECK(re->DataAt(index)->IsSmi());
+  ExpectString("re.exec('xab')[1]", "a");
+  CHECK(re->DataAt(index)->IsByteArray());
+  ExpectString("re.exec('xab')[1]", "a");
+  CHECK(re->DataAt(index)->IsByteArray());
+  // The ticks have run out, the next execution uses native code.
+  ExpectString("re.exec('xab')[1]", "a");
+  CHECK(is_native ? re->DataAt(index)->IsCode()
+                  : re->DataAt(index)->IsByteArray());
+  ExpectString("'xab cab'.replace(/(a)b/g, '$1')", "xa ca");
+
+  // Long subjects are matched with native code right away.
+  Handle<JSRegExp> long_re =
+      CompileRunRegExp("var long_re = /x+(y)/; long_re");
+  ExpectString("long_re.exec('x'.repeat(2000) + 'y')[1]", "y");
+  CHECK(is_native ? long_re->DataAt(index)->IsCode()
+                  : long_re->DataAt(index)->IsByteArray());
+
+  // Without tier-up, regexps are compiled to native code right away.
+  FLAG_regexp_tier_up = false;
+  Handle<JSRegExp> native_re =
+      CompileRunRegExp("var native_re = /z(w)/; native_re");
+  ExpectString("native_re.exec('zw')[1]", "w");
+  CHECK(is_native ? native_re->DataAt(index)->IsCode()
+                  : native_re->DataAt(index)->IsByteArray());
+}
+
+static bool HasSameBytes(ByteArray* a, ByteArray* b) {
+  return a->length() == b->length() &&
+         memcmp(a->GetDataStartAddress(), b->GetDataStartAddress(),
+                a->length()) == 0;
+}
+
+TEST(RegExpBytecodeCache) {
+  FLAG_regexp_tier_up = true;
+  FLAG_regexp_tier_up_ticks = 1;
+  FLAG_harmony_regexp_named_captures = true;
+  RegExpBytecodeCache::Clear();
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext env;
+  Isolate* isolate = CcTest::i_isolate();
+  int index = JSRegExp::code_index(true);
+
+  Handle<JSRegExp> re = CompileRunRegExp("var re = /(a)b|c/; re");
+  ExpectString("re.exec('xab')[1]", "a");
+  Handle<ByteArray> bytecode(ByteArray::cast(re->DataAt(index)));
+  Handle<ByteArray> cached;
+  int num_registers;
+  CHECK(RegExpBytecodeCache::Lookup(isolate, handle(re->Pattern()),
+                                    re->GetFlags(), true, &num_registers)
+            .ToHandle(&cached));
+  CHECK(HasSameBytes(*bytecode, *cached));
+  CHECK_EQ(RegExpImpl::IrregexpMaxRegisterCount(FixedArray::cast(re->data())),
+           num_registers);
+
+  // The same isolate compiles the pattern again once it is gone from the
+  // compilation cache, and finds its bytecode in the shared cache.
+  isolate->compilation_cache()->Clear();
+  Handle<JSRegExp> again = CompileRunRegExp("var again = /(a)b|c/; again");
+  CHECK_NE(again->data(), re->data());
+  ExpectString("again.exec('xab')[1]", "a");
+  CHECK(HasSameBytes(*bytecode, ByteArray::cast(again->DataAt(index))));
+  CHECK_EQ(Smi::kZero, again->DataAt(JSRegExp::kIrregexpCaptureNameMapIndex));
+
+  // Other flags are compiled separately.
+  CHECK(RegExpBytecodeCache::Lookup(isolate, handle(re->Pattern()),
+                                    JSRegExp::kGlobal, true, &num_registers)
+            .is_null());
+
+  // Patterns with named captures are not shared.
+  Handle<JSRegExp> named = CompileRunRegExp("var named = /(?<x>a)b/; named");
+  ExpectString("named.exec('xab').groups.x", "a");
+  CHECK(RegExpBytecodeCache::Lookup(isolate, handle(named->Pattern()),
+                                    named->GetFlags(), true, &num_registers)
+            .is_null());
+
+  // Another isolate copies the bytecode from the cache.
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* other = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(other);
+    v8::HandleScope handle_scope(other);
+    v8::Local<v8::Context> context = v8::Context::New(other);
+    v8::Context::Scope context_scope(context);
+    Handle<JSRegExp> other_re = CompileRunRegExp("var re = /(a)b|c/; re");
+    ExpectString("re.exec('xab')[1]", "a");
+    CHECK(HasSameBytes(*bytecode, ByteArray::cast(other_re->DataAt(index))));
+    CHECK_EQ(Smi::kZero,
+             other_re->DataAt(JSRegExp::kIrregexpCaptureNameMapIndex));
+  }
+  other->Dispose();
+}
+
+TEST(RegExpBytecodeCacheEviction) {
+  FLAG_regexp_tier_up = true;
+  FLAG_regexp_tier_up_ticks = 1;
+  FLAG_regexp_bytecode_cache_size = 1;
+  RegExpBytecodeCache::Clear();
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext env;
+  Isolate* isolate = CcTest::i_isolate();
+  int num_registers;
+
+  Handle<JSRegExp> first = CompileRunRegExp("var re = /(f)irst/; re");
+  ExpectString("re.exec('first')[1]", "f");
+  Handle<String> first_pattern(first->Pattern());
+
+  // Compile more patterns than fit into the cache, while the first one keeps
+  // being looked up.
+  const int kPatterns = 100;
+  for (int i = 0; i < kPatterns; i++) {
+    CHECK(!RegExpBytecodeCache::Lookup(isolate, first_pattern,
+                                       first->GetFlags(), true, &num_registers)
+               .is_null());
+    EmbeddedVector<char, 64> source;
+    SNPrintF(source, "/(p)attern%d/.exec('pattern%d')", i, i);
+    CompileRun(source.start());
+  }
+
+  // The least recently used patterns were evicted, the others are still
+  // there.
+  Handle<String> oldest =
+      isolate->factory()->NewStringFromAsciiChecked("(p)attern0");
+  CHECK(RegExpBytecodeCache::Lookup(isolate, oldest, first->GetFlags(), true,
+                                    &num_registers)
+            .is_null());
+  EmbeddedVector<char, 64> newest_source;
+  SNPrintF(newest_source, "(p)attern%d", kPatterns - 1);
+  Handle<String> newest =
+      isolate->factory()->NewStringFromAsciiChecked(newest_source.start());
+  CHECK(!RegExpBytecodeCache::Lookup(isolate, newest, first->GetFlags(), true,
+                                     &num_registers)
+             .is_null());
+  CHECK(!RegExpBytecodeCache::Lookup(isolate, first_pattern, first->GetFlags(),
+                                     true, &num_registers)
+             .is_null());
+}
+
 }  // namespace test_regexp
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,162 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <stdlib.h>
+
+#include "src/v8.h"
+
+#include "src/base/utils/random-number-generator.h"
+#include "src/bignum-dtoa.h"
+#include "src/double.h"
+#include "src/ryu-dtoa.h"
+#include "src/strtod.h"
+#include "test/cctest/cctest.h"
+#include "test/cctest/gay-shortest.h"
+
+namespace v8 {
+namespace internal {
+namespace test_ryu_dtoa {
+
+static const int kBufferSize = 100;
+
+
+TEST(RyuDtoaVariousDoubles) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+
+  double min_double = 5e-324;
+  RyuDtoa(min_double, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("5", buffer.start()));
+  CHECK_EQ(-323, point);
+
+  double max_double = 1.7976931348623157e308;
+  RyuDtoa(max_double, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("17976931348623157", buffer.start()));
+  CHECK_EQ(309, point);
+
+  RyuDtoa(4294967272.0, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("4294967272", buffer.start()));
+  CHECK_EQ(10, point);
+
+  RyuDtoa(4.1855804968213567e298, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("4185580496821357", buffer.start()));
+  CHECK_EQ(299, point);
+
+  RyuDtoa(5.5626846462680035e-309, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("5562684646268003", buffer.start()));
+  CHECK_EQ(-308, point);
+
+  RyuDtoa(2147483648.0, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("2147483648", buffer.start()));
+  CHECK_EQ(10, point);
+
+  RyuDtoa(3.5844466002796428e+298, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("35844466002796428", buffer.start()));
+  CHECK_EQ(299, point);
+
+  // Round numbers never leave a trailing zero in the buffer.
+  RyuDtoa(1e23, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("1", buffer.start()));
+  CHECK_EQ(24, point);
+
+  RyuDtoa(9007199254740992.0, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("9007199254740992", buffer.start()));
+  CHECK_EQ(16, point);
+
+  uint64_t smallest_normal64 = V8_2PART_UINT64_C(0x00100000, 00000000);
+  double v = Double(smallest_normal64).value();
+  RyuDtoa(v, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("22250738585072014", buffer.start()));
+  CHECK_EQ(-307, point);
+
+  uint64_t largest_denormal64 = V8_2PART_UINT64_C(0x000FFFFF, FFFFFFFF);
+  v = Double(largest_denormal64).value();
+  RyuDtoa(v, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("2225073858507201", buffer.start()));
+  CHECK_EQ(-307, point);
+}
+
+
+TEST(RyuDtoaGayShortest) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+  bool needed_max_length = false;
+
+  Vector<const PrecomputedShortest> precomputed =
+      PrecomputedShortestRepresentations();
+  for (int i = 0; i < precomputed.length(); ++i) {
+    const PrecomputedShortest current_test = precomputed[i];
+    double v = current_test.v;
+    RyuDtoa(v, buffer, &length, &point);
+    CHECK_GE(kRyuDtoaMaximalLength, length);
+    if (length == kRyuDtoaMaximalLength) needed_max_length = true;
+    CHECK_EQ(current_test.decimal_point, point);
+    CHECK_EQ(0, strcmp(current_test.representation, buffer.start()));
+  }
+  CHECK(needed_max_length);
+}
+
+
+// Compares RyuDtoa against BignumDtoa and checks that Strtod reads the
+// digits back to the same double.
+static void CheckAgainstBignumDtoa(double v) {
+  if (!(v > 0) || Double(v).IsSpecial()) return;
+  char ryu_container[kBufferSize];
+  Vector<char> ryu_buffer(ryu_container, kBufferSize);
+  int ryu_length;
+  int ryu_point;
+  RyuDtoa(v, ryu_buffer, &ryu_length, &ryu_point);
+
+  char bignum_container[kBufferSize];
+  Vector<char> bignum_buffer(bignum_container, kBufferSize);
+  int bignum_length;
+  int bignum_point;
+  BignumDtoa(v, BIGNUM_DTOA_SHORTEST, 0, bignum_buffer, &bignum_length,
+             &bignum_point);
+  bignum_buffer[bignum_length] = '\0';
+
+  CHECK_EQ(bignum_length, ryu_length);
+  CHECK_EQ(bignum_point, ryu_point);
+  CHECK_EQ(0, strcmp(bignum_buffer.start(), ryu_buffer.start()));
+  CHECK_EQ(v, Strtod(Vector<const char>(ryu_container, ryu_length),
+                     ryu_point - ryu_length));
+}
+
+
+static const int kRandomDoubleCount = 100000;
+
+TEST(RyuDtoaMatchesBignumDtoa) {
+  // The boundaries of every binade: powers of two (whose lower neighbour is
+  // closer), their successors, and the largest significands.
+  for (uint64_t exponent = 0; exponent < 0x7FF; exponent++) {
+    for (uint64_t significand = 0; significand < 4; significand++) {
+      uint64_t bits = (exponent << Double::kPhysicalSignificandSize);
+      CheckAgainstBignumDtoa(Double(bits | significand).value());
+      CheckAgainstBignumDtoa(
+          Double(bits | (Double::kSignificandMask - significand)).value());
+    }
+  }
+  // Integers and short decimals, which exercise the exact (trailing zeros)
+  // paths.
+  for (int i = 1; i < 10000; i++) {
+    CheckAgainstBignumDtoa(i);
+    CheckAgainstBignumDtoa(i / 1000.0);
+    CheckAgainstBignumDtoa(i * 1e-7);
+    CheckAgainstBignumDtoa(i * 1e15);
+  }
+  v8::base::RandomNumberGenerator rng(42);
+  for (int i = 0; i < kRandomDoubleCount; i++) {
+    uint64_t bits = static_cast<uint64_t>(rng.NextInt64()) &
+                    ~Double::kSignMask;
+    CheckAgainstBignumDtoa(Double(bits).value());
+  }
+}
+
+}  // namespace test_ryu_dtoa
+}  // namespace internal
+}  // namespace v8
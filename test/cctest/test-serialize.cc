@@ -2011,6 +2011,145 @@ TEST(CodeSerializerIsolatesEager) {
   isolate2->Dispose();
 }
 
+TEST(CodeSerializerPreParsedScopeData) {
+  // Uncompiled functions keep their preparsed scope data across the code
+  // cache, so that compiling them lazily does not need to preparse their
+  // inner functions again.
+  const char* source =
+      "function f() {"
+      "  var a = 'abc';"
+      "  function g() {"
+      "    function h() { return a; }"
+      "    return h();"
+      "  }"
+      "  return g;"
+      "}"
+      "f()() + 'def'";
+  v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+
+    i::Handle<i::SharedFunctionInfo> toplevel = v8::Utils::OpenHandle(*script);
+    i::Handle<i::Script> i_script(Script::cast(toplevel->script()));
+    i::SharedFunctionInfo::ScriptIterator iterator(i_script);
+    int uncompiled_count = 0;
+    while (SharedFunctionInfo* next = iterator.Next()) {
+      if (next->is_toplevel() || next->is_compiled()) continue;
+      CHECK(next->HasPreParsedScopeData());
+      uncompiled_count++;
+    }
+    CHECK_EQ(1, uncompiled_count);
+
+    v8::Local<v8::Value> result = script->BindToCurrentContext()
+                                      ->Run(isolate2->GetCurrentContext())
+                                      .ToLocalChecked();
+    CHECK(result->ToString(isolate2->GetCurrentContext())
+              .ToLocalChecked()
+              ->Equals(isolate2->GetCurrentContext(), v8_str("abcdef"))
+              .FromJust());
+  }
+  isolate2->Dispose();
+  delete cache;
+}
+
+TEST(CodeSerializerPreParsedScopeDataAfterExecute) {
+  // Functions that are still uncompiled after the outer function ran keep
+  // their preparsed scope data across the code cache too. Compiling them
+  // lazily uses the data and skips their inner functions without preparsing.
+  FLAG_runtime_stats = 1;
+  const char* source =
+      "function f() {"
+      "  var a = 'abc';"
+      "  function g() {"
+      "    function h() { return a; }"
+      "    return h();"
+      "  }"
+      "  return g;"
+      "}"
+      "var g = f();";
+  v8::ScriptCompiler::CachedData* cache =
+      CompileRunAndProduceCache(source, CodeCacheType::kAfterExecute);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+
+    // {f} is compiled, {g} is not but has the data to skip {h}.
+    i::Handle<i::SharedFunctionInfo> toplevel = v8::Utils::OpenHandle(*script);
+    i::Handle<i::Script> i_script(Script::cast(toplevel->script()));
+    i::SharedFunctionInfo::ScriptIterator iterator(i_script);
+    int compiled_count = 0;
+    Handle<SharedFunctionInfo> g;
+    while (SharedFunctionInfo* next = iterator.Next()) {
+      if (next->is_toplevel()) continue;
+      if (next->is_compiled()) {
+        compiled_count++;
+        continue;
+      }
+      CHECK(g.is_null());
+      g = handle(next);
+    }
+    CHECK_EQ(1, compiled_count);
+    CHECK(!g.is_null());
+    CHECK(g->HasPreParsedScopeData());
+
+    script->BindToCurrentContext()
+        ->Run(isolate2->GetCurrentContext())
+        .ToLocalChecked();
+    CHECK(!g->is_compiled());
+
+    i::Isolate* i_isolate2 = reinterpret_cast<i::Isolate*>(isolate2);
+    RuntimeCallStats* stats = i_isolate2->counters()->runtime_call_stats();
+    stats->Reset();
+    v8::Local<v8::Value> result = CompileRun("g() + 'def'");
+    CHECK(result->Equals(isolate2->GetCurrentContext(), v8_str("abcdef"))
+              .FromJust());
+    CHECK(g->is_compiled());
+    CHECK(!g->HasPreParsedScopeData());
+    CHECK_EQ(0, stats
+                    ->GetCounter(
+                        RuntimeCallCounterId::kPreParseNoVariableResolution)
+                    ->count());
+    CHECK_EQ(0, stats
+                    ->GetCounter(
+                        RuntimeCallCounterId::kPreParseWithVariableResolution)
+                    ->count());
+  }
+  isolate2->Dispose();
+  delete cache;
+  FLAG_runtime_stats = 0;
+}
+
 TEST(CodeSerializerAfterExecute) {
   // We test that no compilations happen when running this code. Forcing
   // to always optimize breaks this test.
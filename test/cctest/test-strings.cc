@@ -911,6 +911,77 @@ TEST(DeepOneByte) {
 }
 
 
+static int ConsStringDepth(String* string) {
+  if (!string->IsConsString()) return 0;
+  ConsString* cons = ConsString::cast(string);
+  return 1 + Max(ConsStringDepth(cons->first()),
+                 ConsStringDepth(cons->second()));
+}
+
+
+static const int kAppendCount = 100000;
+// Twice the binary logarithm of kAppendCount, rounded up.
+static const int kMaxAppendDepth = 34;
+
+
+TEST(ConsStringAppendStaysBalanced) {
+  CcTest::InitializeVM();
+  Factory* factory = CcTest::i_isolate()->factory();
+  v8::HandleScope scope(CcTest::isolate());
+
+  // Parts that are joined into flat strings, and parts that are not.
+  const char* parts[] = {"a", "foo bar", "a part longer than kMinLength"};
+  for (const char* part : parts) {
+    HandleScope inner_scope(CcTest::i_isolate());
+    Handle<String> part_string = factory->NewStringFromAsciiChecked(part);
+    int part_length = part_string->length();
+    Handle<String> string = factory->empty_string();
+    for (int i = 0; i < kAppendCount; i++) {
+      string = factory->NewConsString(string, part_string).ToHandleChecked();
+    }
+    CHECK_EQ(kAppendCount * part_length, string->length());
+    CHECK_LE(ConsStringDepth(*string), kMaxAppendDepth);
+    for (int i = 0; i < string->length(); i += 997) {
+      CHECK_EQ(part[i % part_length], string->Get(i));
+    }
+    Handle<String> flat = String::Flatten(string);
+    for (int i = 0; i < flat->length(); i++) {
+      CHECK_EQ(part[i % part_length], flat->Get(i));
+    }
+  }
+}
+
+
+TEST(ConsStringJoinKeepsSimilarParts) {
+  CcTest::InitializeVM();
+  Factory* factory = CcTest::i_isolate()->factory();
+  v8::HandleScope scope(CcTest::isolate());
+
+  Handle<String> block = factory->NewStringFromAsciiChecked("0123456789");
+  Handle<String> left =
+      factory->NewConsString(block, block).ToHandleChecked();
+  Handle<String> right =
+      factory->NewConsString(block, block).ToHandleChecked();
+  // Joining two trees of similar length doesn't restructure either of them.
+  Handle<String> joined =
+      factory->NewConsString(left, right).ToHandleChecked();
+  CHECK(joined->IsConsString());
+  CHECK_EQ(*left, ConsString::cast(*joined)->first());
+  CHECK_EQ(*right, ConsString::cast(*joined)->second());
+
+  // Appending a short part joins it with the second part of the tree.
+  Handle<String> appended =
+      factory->NewConsString(joined, block).ToHandleChecked();
+  CHECK(appended->IsConsString());
+  CHECK_EQ(*left, ConsString::cast(*appended)->first());
+  CHECK_EQ(2, ConsStringDepth(ConsString::cast(*appended)->second()));
+  CHECK(String::Equals(
+      factory->NewStringFromAsciiChecked(
+          "01234567890123456789012345678901234567890123456789"),
+      String::Flatten(appended)));
+}
+
+
 TEST(Utf8Conversion) {
   // Smoke test for converting strings to utf-8.
   CcTest::InitializeVM();
@@ -1155,6 +1226,46 @@ TEST(CachedHashOverflow) {
 }
 
 
+TEST(HashIndependentOfRepresentation) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  v8::HandleScope scope(CcTest::isolate());
+  // The length is not a multiple of the hasher's block size, and the cons
+  // string below is split in the middle of a block.
+  const uint8_t chars[] = "abc\xE9" "defghijklmnopq";
+  const int length = static_cast<int>(arraysize(chars)) - 1;
+  const int split = 3;
+
+  Handle<String> one_byte =
+      factory->NewStringFromOneByte(Vector<const uint8_t>(chars, length))
+          .ToHandleChecked();
+  Handle<SeqTwoByteString> two_byte =
+      factory->NewRawTwoByteString(length).ToHandleChecked();
+  CopyChars(two_byte->GetChars(), chars, length);
+  CHECK(one_byte->IsOneByteRepresentation());
+  CHECK(two_byte->IsTwoByteRepresentation());
+  CHECK_EQ(one_byte->Hash(), two_byte->Hash());
+
+  Handle<String> left =
+      factory->NewStringFromOneByte(Vector<const uint8_t>(chars, split))
+          .ToHandleChecked();
+  Handle<SeqTwoByteString> right =
+      factory->NewRawTwoByteString(length - split).ToHandleChecked();
+  CopyChars(right->GetChars(), chars + split, length - split);
+  Handle<String> cons = factory->NewConsString(left, right).ToHandleChecked();
+  CHECK(cons->IsConsString());
+  CHECK_EQ(one_byte->Hash(), cons->Hash());
+
+  const char utf8[] = "abc\xC3\xA9" "defghijklmnopq";
+  int utf16_length = 0;
+  uint32_t utf8_hash_field = StringHasher::ComputeUtf8Hash(
+      CStrVector(utf8), isolate->heap()->HashSeed(), &utf16_length);
+  CHECK_EQ(length, utf16_length);
+  CHECK_EQ(one_byte->hash_field(), utf8_hash_field);
+}
+
+
 TEST(SliceFromCons) {
   if (!FLAG_string_slices) return;
   CcTest::InitializeVM();
@@ -481,6 +481,31 @@ TEST(RandomStrtod) {
   }
 }
 
+
+static const int kUint64StrtodRandomCount = 2000;
+
+// Inputs of up to 19 significant digits take the 128-bit fast path; slightly
+// longer ones take it twice (truncated and incremented). Check both against
+// the exact bignum comparison over the whole exponent range.
+TEST(RandomStrtodUint64Digits) {
+  v8::base::RandomNumberGenerator rng;
+  char buffer[kBufferSize];
+  for (int length = 16; length <= 24; length++) {
+    for (int i = 0; i < kUint64StrtodRandomCount; ++i) {
+      int pos = 0;
+      buffer[pos++] = rng.NextInt(9) + '1';
+      for (int j = 1; j < length; ++j) {
+        buffer[pos++] = rng.NextInt(10) + '0';
+      }
+      int exponent = rng.NextInt(309 + 324 + length) - 324 - length;
+      buffer[pos] = '\0';
+      Vector<const char> vector(buffer, pos);
+      double strtod_result = Strtod(vector, exponent);
+      CHECK(CheckDouble(vector, exponent, strtod_result));
+    }
+  }
+}
+
 }  // namespace test_strtod
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,48 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+load("base.js");
+
+var str;
+var re;
+
+function Backtracking() {
+  re.exec(str);
+}
+
+// Nested quantifiers: exponential for a backtracking engine.
+function Backtracking1Setup() {
+  re = /(a+)+b/;
+  str = "a".repeat(16);
+}
+
+// Overlapping alternatives in a loop.
+function Backtracking2Setup() {
+  re = /(a|aa)*c/;
+  str = "a".repeat(24);
+}
+
+// A typical validation pattern on input that does not validate.
+function Backtracking3Setup() {
+  re = /^(\w+\s?)*$/;
+  str = "validation pattern!";
+}
+
+// The same patterns on input they match.
+function Backtracking4Setup() {
+  re = /(a+)+b/;
+  str = createHaystack() + "aab";
+}
+
+function Backtracking5Setup() {
+  re = /^(\w+\s?)*$/;
+  str = "validation pattern";
+}
+
+var benchmarks = [ [Backtracking, Backtracking1Setup],
+                   [Backtracking, Backtracking2Setup],
+                   [Backtracking, Backtracking3Setup],
+                   [Backtracking, Backtracking4Setup],
+                   [Backtracking, Backtracking5Setup],
+                 ];
@@ -0,0 +1,53 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('StringEqualTwoByte', [5], [
+  new Benchmark('StringEqualTwoByte', true, false, 0,
+  StringEqualTwoByte),
+]);
+
+new BenchmarkSuite('StringHashOneByte', [5], [
+  new Benchmark('StringHashOneByte', true, false, 0,
+  StringHashOneByte),
+]);
+
+new BenchmarkSuite('StringHashTwoByte', [5], [
+  new Benchmark('StringHashTwoByte', true, false, 0,
+  StringHashTwoByte),
+]);
+
+// Equal strings that are not internalized, so comparing them has to look at
+// their characters.
+const two_byte_left = "一丁丂七".repeat(10).split("").join("");
+const two_byte_right = "一丁丂七".repeat(10).split("").join("");
+
+function StringEqualTwoByte() {
+  var count = 0;
+  for (var i = 0; i < 100; ++i) {
+    if (two_byte_left === two_byte_right) count++;
+  }
+  return count;
+}
+
+// Looking up a fresh string as a property key internalizes it, which hashes
+// all its characters.
+const one_byte_prefix = "some_rather_long_property_name_";
+const two_byte_prefix = "一丁丂七一丁丂七一丁丂七一丁丂七_";
+const object = {};
+
+function StringHashOneByte() {
+  var count = 0;
+  for (var i = 0; i < 100; ++i) {
+    if (object[one_byte_prefix + i] === undefined) count++;
+  }
+  return count;
+}
+
+function StringHashTwoByte() {
+  var count = 0;
+  for (var i = 0; i < 100; ++i) {
+    if (object[two_byte_prefix + i] === undefined) count++;
+  }
+  return count;
+}
@@ -34,3 +34,56 @@ function StringIndexOfNonConstant() {
 
   return sum;
 }
+
+new BenchmarkSuite('StringIndexOfTwoByteChar', [5], [
+  new Benchmark('StringIndexOfTwoByteChar', true, false, 0,
+  StringIndexOfTwoByteChar),
+]);
+
+new BenchmarkSuite('StringIndexOfShortPattern', [5], [
+  new Benchmark('StringIndexOfShortPattern', true, false, 0,
+  StringIndexOfShortPattern),
+]);
+
+new BenchmarkSuite('StringIndexOfTwoByteShortPattern', [5], [
+  new Benchmark('StringIndexOfTwoByteShortPattern', true, false, 0,
+  StringIndexOfTwoByteShortPattern),
+]);
+
+new BenchmarkSuite('StringSplitTwoByteChar', [5], [
+  new Benchmark('StringSplitTwoByteChar', true, false, 0,
+  StringSplitTwoByteChar),
+]);
+
+new BenchmarkSuite('StringReplaceShortPattern', [5], [
+  new Benchmark('StringReplaceShortPattern', true, false, 0,
+  StringReplaceShortPattern),
+]);
+
+// CJK text shares the high byte of most of its characters, which defeats a
+// byte-wise memchr.
+const two_byte_subject = "一丁丂七".repeat(256) + "中";
+const two_byte_csv = "一丁,丂".repeat(256);
+// The first character of the pattern is frequent, the last one is not.
+const one_byte_subject = "e ".repeat(512) + "end";
+const two_byte_pattern_subject = "一 ".repeat(512) + "一丁丂";
+
+function StringIndexOfTwoByteChar() {
+  return two_byte_subject.indexOf("中");
+}
+
+function StringIndexOfShortPattern() {
+  return one_byte_subject.indexOf("end");
+}
+
+function StringIndexOfTwoByteShortPattern() {
+  return two_byte_pattern_subject.indexOf("一丁丂");
+}
+
+function StringSplitTwoByteChar() {
+  return two_byte_csv.split(",").length;
+}
+
+function StringReplaceShortPattern() {
+  return one_byte_subject.replace("end", "END");
+}
@@ -0,0 +1,58 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Arrays of strings, numbers, booleans, null and undefined.
+assertEquals("1,2,3", [1, 2, 3].join());
+assertEquals("1-2-3", [1, 2, 3].join("-"));
+assertEquals("123", [1, 2, 3].join(""));
+assertEquals("0,-1,2147483647,-1073741824",
+             [-0, -1, 2147483647, -1073741824].join());
+assertEquals("0.5,0,NaN,Infinity,1e+21,1.5e-7",
+             [0.5, -0, NaN, Infinity, 1e21, 1.5e-7].join());
+assertEquals("a,,b,,true,false,1.5",
+             ["a", null, "b", undefined, true, false, 1.5].join());
+assertEquals("aሴb", ["a", "b"].join("ሴ"));
+assertEquals("ሴ,\xe4", ["ሴ", "\xe4"].join());
+assertEquals("x\xe4y", ["x", "y"].join("\xe4"));
+assertEquals("1,2,3", [1, 2, 3].toString());
+assertEquals("1.5,2.5", String([1.5, 2.5]));
+
+// Holes read through the prototype chain.
+var holey = [1, , 3];
+assertEquals("1,,3", holey.join());
+var holeyDouble = [1.5, , 3.5];
+assertEquals("1.5,,3.5", holeyDouble.join());
+Array.prototype[1] = "proto";
+assertEquals("1,proto,3", holey.join());
+assertEquals("1.5,proto,3.5", holeyDouble.join());
+delete Array.prototype[1];
+assertEquals("1,,3", holey.join());
+
+// Elements that call back into JavaScript.
+var calls = 0;
+var object = {toString() { calls++; return "o"; }};
+assertEquals("1,o,3", [1, object, 3].join());
+assertEquals(1, calls);
+assertEquals("1,a,b,3", [1, ["a", "b"], 3].join());
+assertThrows(() => [1, Symbol.iterator, 3].join(), TypeError);
+
+// Separators that change the array.
+var array = [1, 2, 3, 4];
+var separator = {toString() { array.length = 2; return "+"; }};
+assertEquals("1+2++", array.join(separator));
+array = ["a", "b"];
+separator = {toString() { array.push("c"); return "-"; }};
+assertEquals("a-b", array.join(separator));
+
+// Arrays that become simple while they are being joined stay cyclic.
+var cyclic = [1, 2];
+cyclic[2] = {toString() { cyclic[2] = 3; return cyclic.join("-"); }};
+assertEquals("1,2,", cyclic.join());
+assertEquals("1,2,3", cyclic.join());
+
+// Long results.
+var long = new Array(1000).fill("abc");
+assertEquals(3999, long.join(",").length);
+assertThrows(() => new Array(1 << 20).fill("x".repeat(1 << 10)).join(),
+             RangeError);
@@ -0,0 +1,85 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Sorting with a comparison function is stable.
+function TestStable(length) {
+  var array = [];
+  for (var i = 0; i < length; i++) array.push({key: i % 7, index: i});
+  array.sort((a, b) => a.key - b.key);
+  for (var i = 1; i < length; i++) {
+    var a = array[i - 1];
+    var b = array[i];
+    assertTrue(a.key < b.key || (a.key == b.key && a.index < b.index));
+  }
+}
+[0, 1, 2, 9, 10, 11, 20, 21, 100, 1000, 5000].forEach(TestStable);
+
+// Comparison results that are not positive keep the order.
+var array = [3, 1, 2, 5, 4, 0, 9, 8, 7, 6, 10, 12, 11];
+assertEquals([3, 1, 2, 5, 4, 0, 9, 8, 7, 6, 10, 12, 11],
+             array.slice().sort(() => NaN));
+assertEquals([3, 1, 2, 5, 4, 0, 9, 8, 7, 6, 10, 12, 11],
+             array.slice().sort(() => undefined));
+assertEquals([0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12],
+             array.slice().sort((a, b) => a - b));
+assertEquals([12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0],
+             array.slice().sort((a, b) => b - a));
+
+// Presorted input needs few comparisons.
+var sorted = [];
+for (var i = 0; i < 1000; i++) sorted.push(i);
+var comparisons = 0;
+sorted.sort((a, b) => { comparisons++; return a - b; });
+assertTrue(comparisons < 2000);
+
+// The default comparator compares strings.
+assertEquals([-1, -10, 0, 1, 10, 100, 2, 9],
+             [10, 9, 1, 100, 2, 0, -1, -10].sort());
+assertEquals([-0.5, 0.25, 1.5, 10.5, 2.5, Infinity, NaN],
+             [NaN, 2.5, 10.5, Infinity, -0.5, 1.5, 0.25].sort());
+assertEquals(["A", "B", "a", "b", "\xe4", "ሴ"],
+             ["ሴ", "b", "\xe4", "a", "B", "A"].sort());
+assertEquals(["a", "ab", "abc", "b"], ["abc", "b", "ab", "a"].sort());
+assertEquals([1, "1", 10, "2", 2, false, null, true],
+             [true, "2", 10, null, 1, 2, false, "1"].sort());
+var holey = [3, , 1, undefined, 2];
+holey.sort();
+assertEquals([1, 2, 3, undefined], holey.slice(0, 4));
+assertEquals(5, holey.length);
+assertFalse(4 in holey);
+
+// Equal strings of the default comparator keep their order.
+var strings = [new String("b"), "a", "b", new String("a")];
+strings.sort();
+assertEquals("string", typeof strings[0]);
+assertEquals("object", typeof strings[1]);
+assertEquals("object", typeof strings[2]);
+assertEquals("string", typeof strings[3]);
+var numbers = [2, "1", 1, "2", 1.5, "1.5"].sort();
+assertEquals(["1", 1, 1.5, "1.5", 2, "2"], numbers);
+
+// Literal arrays are copied before sorting.
+function literal() { return [3, 1, 2]; }
+assertEquals([1, 2, 3], literal().sort());
+assertEquals([3, 1, 2], literal());
+
+// Typed arrays with a comparison function are sorted stably too.
+var typed = new Int32Array([5, 3, 8, 1, 9, 2, 7, 4, 6, 0, 11, 10]);
+typed.sort((a, b) => (a & 1) - (b & 1));
+assertEquals([8, 2, 4, 6, 0, 10, 5, 3, 1, 9, 7, 11], Array.from(typed));
+
+// A comparison function that throws partway through leaves a permutation of
+// the elements behind, in insertion sort as well as in the merges.
+for (var limit of [1, 5, 30, 100, 300, 600]) {
+  var shuffled = [];
+  for (var i = 0; i < 100; i++) shuffled.push((i * 37) % 100);
+  var calls = 0;
+  assertThrows(() => shuffled.sort((a, b) => {
+    if (++calls == limit) throw new Error("comparefn");
+    return a - b;
+  }), Error, "comparefn");
+  assertEquals(100, shuffled.length);
+  var sorted = shuffled.slice().sort((a, b) => a - b);
+  for (var i = 0; i < 100; i++) assertEquals(i, sorted[i]);
+}
@@ -0,0 +1,142 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Test RegExp.prototype.test on known regexps.
+(() => {
+  function f(re, s) {
+    return re.test(s);
+  }
+
+  assertTrue(f(/b+/, "abbc"));
+  assertFalse(f(/x/, "abbc"));
+  %OptimizeFunctionOnNextCall(f);
+  assertTrue(f(/b+/, "abbc"));
+  assertFalse(f(/x/, "abbc"));
+  assertEquals("bb", RegExp.lastMatch);
+  assertOptimized(f);
+})();
+
+// Test RegExp.prototype.exec on known regexps.
+(() => {
+  function f(re, s) {
+    return re.exec(s);
+  }
+
+  assertEquals(["bb", "b"], f(/(b)+/, "abbc"));
+  assertNull(f(/x/, "abbc"));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(["bb", "b"], f(/(b)+/, "abbc"));
+  assertNull(f(/x/, "abbc"));
+  assertOptimized(f);
+})();
+
+// Test RegExp.prototype.exec with an unused result, which must still update
+// lastIndex and the last match info.
+(() => {
+  function f(re, s) {
+    re.exec(s);
+  }
+
+  const re = /a(\d)/g;
+  f(re, "a1a2a3");
+  f(re, "a1a2a3");
+  assertEquals(4, re.lastIndex);
+  %OptimizeFunctionOnNextCall(f);
+  f(re, "a1a2a3");
+  assertEquals(6, re.lastIndex);
+  assertEquals("3", RegExp.$1);
+  f(re, "a1a2a3");
+  assertEquals(0, re.lastIndex);
+  assertOptimized(f);
+})();
+
+// Test RegExp.prototype.exec with a result that is only tested for
+// truthiness.
+(() => {
+  function f(re, s) {
+    return re.exec(s) ? 1 : 0;
+  }
+
+  const re = /a(\d)/g;
+  assertEquals(1, f(re, "a1a2"));
+  assertEquals(1, f(re, "a1a2"));
+  assertEquals(0, f(re, "a1a2"));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(1, f(re, "a1a2"));
+  assertEquals(2, re.lastIndex);
+  assertEquals("1", RegExp.$1);
+  assertEquals(1, f(re, "a1a2"));
+  assertEquals(0, f(re, "a1a2"));
+  assertEquals(0, re.lastIndex);
+  assertOptimized(f);
+})();
+
+// Test RegExp.prototype.exec with a result that is only indexed with [0],
+// which must still throw if there is no match.
+(() => {
+  function f(re, s) {
+    return re.exec(s)[0];
+  }
+
+  const re = /a(\d)/g;
+  assertEquals("a1", f(re, "a1a2"));
+  assertEquals("a2", f(re, "a1a2"));
+  re.lastIndex = 0;
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals("a1", f(re, "a1a2"));
+  assertEquals("a2", f(re, "a1a2"));
+  assertEquals(4, re.lastIndex);
+  assertEquals("2", RegExp.$1);
+  assertOptimized(f);
+  assertThrows(() => f(re, "a1a2"), TypeError,
+               "Cannot read property '0' of null");
+  assertEquals(0, re.lastIndex);
+})();
+
+// Test that non-String arguments deoptimize.
+(() => {
+  function f(re, s) {
+    return re.test(s);
+  }
+
+  assertTrue(f(/1/, "1"));
+  assertTrue(f(/1/, "1"));
+  %OptimizeFunctionOnNextCall(f);
+  assertTrue(f(/1/, 1));
+  assertTrue(f(/undefined/, undefined));
+})();
+
+// Test that test calls a modified exec.
+(() => {
+  function f(re, s) {
+    return re.test(s);
+  }
+
+  const re = /a/;
+  assertTrue(f(re, "a"));
+  assertTrue(f(re, "a"));
+  %OptimizeFunctionOnNextCall(f);
+  re.exec = () => null;
+  assertFalse(f(re, "a"));
+})();
+
+// Test that exceptions from exec propagate to a surrounding try.
+(() => {
+  function f(re, s) {
+    try {
+      return re.test(s);
+    } catch (e) {
+      return e;
+    }
+  }
+
+  const re = /a/;
+  assertTrue(f(re, "a"));
+  assertTrue(f(re, "a"));
+  %OptimizeFunctionOnNextCall(f);
+  re.exec = () => { throw 42; };
+  assertEquals(42, f(re, "a"));
+})();
@@ -0,0 +1,73 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Strings built by repeated concatenation are rebalanced as they grow. Check
+// that the contents survive, for parts of mixed lengths and encodings, both
+// in the interpreter and in optimized code.
+
+var parts = ["a", "ሴ", "foo bar", "ሴbc", "0123456789abcdef",
+             "ሴ0123456789abcdef", "x".repeat(100)];
+
+function Append(count, offset) {
+  var s = "";
+  for (var i = 0; i < count; i++) {
+    s += parts[(i + offset) % parts.length];
+  }
+  return s;
+}
+
+function Expected(count, offset) {
+  var array = [];
+  for (var i = 0; i < count; i++) {
+    array.push(parts[(i + offset) % parts.length]);
+  }
+  return array.join("");
+}
+
+function Check(count, offset) {
+  var s = Append(count, offset);
+  var expected = Expected(count, offset);
+  assertEquals(expected.length, s.length);
+  for (var i = 0; i < s.length; i += 97) {
+    assertEquals(expected.charCodeAt(i), s.charCodeAt(i));
+  }
+  assertEquals(expected, s);
+}
+
+for (var offset = 0; offset < parts.length; offset++) {
+  Check(1000, offset);
+}
+Check(10000, 0);
+%OptimizeFunctionOnNextCall(Append);
+for (var offset = 0; offset < parts.length; offset++) {
+  Check(1000, offset);
+}
+Check(10000, 0);
+
+// Appending one part at a time to a single growing string.
+(function() {
+  function AppendPart(s, part) { return s + part; }
+  var s = "";
+  var expected = [];
+  for (var i = 0; i < 20000; i++) {
+    if (i == 5000) %OptimizeFunctionOnNextCall(AppendPart);
+    var part = parts[i % 3];
+    s = AppendPart(s, part);
+    expected.push(part);
+  }
+  assertEquals(expected.join(""), s);
+})();
+
+// Joining strings of similar lengths, and flattened strings.
+(function() {
+  var left = Append(500, 1);
+  var right = Append(500, 2);
+  var joined = left + right;
+  assertEquals(Expected(500, 1) + Expected(500, 2), joined);
+  // Comparing flattens {joined} in place; appending to it still works.
+  var appended = joined + "tail";
+  assertEquals(Expected(500, 1) + Expected(500, 2) + "tail", appended);
+})();
@@ -0,0 +1,108 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --json-literal-initializers --json-literal-initializer-min-size=0
+
+// Top-level initializers that are plain JSON text are created by the JSON
+// parser, all others by the regular object and array literals.
+
+var object = {"a": 1, "b": [true, false, null], "c": {"d": "e"}};
+assertEquals({a: 1, b: [true, false, null], c: {d: "e"}}, object);
+
+let array = [ -0, 0.5, -1.25e+2, 1E3, 123456789012345678901234567890 ];
+assertEquals(-Infinity, 1 / array[0]);
+assertEquals([-0, 0.5, -125, 1000, 1.2345678901234568e+29], array);
+
+const strings = ["\"\\\/\b\f\n\r\t", "ä😀", "café \ud83d"];
+assertEquals('"\\/\b\f\n\r\t', strings[0]);
+assertEquals("ä😀", strings[1]);
+assertEquals(6, strings[2].length);
+
+var first = [1], second = {"2": [3]}, third = [];
+assertEquals([1], first);
+assertEquals([3], second[2]);
+assertEquals([], third);
+
+var elements = {"1": "a", "0": "b", "x": "c", "1": "d"};
+assertEquals(["0", "1", "x"], Object.keys(elements));
+assertEquals("d", elements[1]);
+
+var withoutSemicolon = {"a": 1}
+var afterNewline = [2]
+assertEquals(1, withoutSemicolon.a);
+assertEquals([2], afterNewline);
+
+// "__proto__" sets the prototype in an object literal.
+var proto = {"__proto__": [], "length": 0};
+assertTrue(Array.isArray(Object.getPrototypeOf(proto)));
+assertFalse(proto.hasOwnProperty("__proto__"));
+
+var escapedName = {"\u0061": 1};
+assertEquals({a: 1}, escapedName);
+
+// Literals that continue into a larger expression.
+var property = {"a": {"b": 1}}.a;
+assertEquals({b: 1}, property);
+var element = [1, 2, 3]
+[1];
+assertEquals(2, element);
+var sum = [1] + [2];
+assertEquals("12", sum);
+
+// Literals that aren't JSON text.
+var unquoted = {a: 1, "b": 2};
+assertEquals({a: 1, b: 2}, unquoted);
+var singleQuoted = ['a', "b"];
+assertEquals(["a", "b"], singleQuoted);
+var hex = [0x10, 010, .5, 5.];
+assertEquals([16, 8, 0.5, 5], hex);
+var withComment = [1, /* two */ 2];
+assertEquals([1, 2], withComment);
+var escapes = ["\x41\v\0"];
+assertEquals("A\v\0", escapes[0]);
+var tab = ["	"];
+assertEquals("\t", tab[0]);
+var computed = [1, 1 + 1];
+assertEquals([1, 2], computed);
+var holes = [1, , 3];
+assertEquals(3, holes.length);
+assertFalse(1 in holes);
+
+// Each evaluation creates a fresh object.
+var objects = [];
+for (var i = 0; i < 2; i++) {
+  var fresh = {"a": []};
+  objects.push(fresh);
+}
+assertNotSame(objects[0], objects[1]);
+assertNotSame(objects[0].a, objects[1].a);
+
+// Later evaluations copy a boilerplate, which changes to the values of
+// earlier ones don't affect.
+for (var i = 0; i < 3; i++) {
+  var copied = {"a": [1, 2.5], "b": {"c": "d"}};
+  assertEquals({a: [1, 2.5], b: {c: "d"}}, copied);
+  copied.a.push(i);
+  copied.b.c = i;
+  copied.e = i;
+}
+
+// Initializers inside functions keep using literals.
+function f() {
+  var local = {"a": [1]};
+  return local;
+}
+assertEquals({a: [1]}, f());
+assertNotSame(f(), f());
+
+// Declarations in eval code and other scripts.
+eval('var evaluated = {"a": [1, {"b": null}]};');
+assertEquals({a: [1, {b: null}]}, evaluated);
+Realm.eval(Realm.current(), 'var global = ["x", {"y": -0.0e0}];');
+assertEquals(["x", {y: -0}], global);
+for (var i = 0; i < 3; i++) {
+  var rerun = Realm.eval(Realm.current(), 'var again = {"a": [1]}; again');
+  assertEquals({a: [1]}, rerun);
+  rerun.a[0] = 2;
+}
@@ -0,0 +1,63 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Objects of a repeated shape share their map, also where the maps along the
+// way have several transitions.
+var objects = JSON.parse(
+    '[{"a": 1, "b": "x"}, {"a": 1, "c": true}, {"a": 2, "b": "y"},' +
+    ' {"a": 2, "c": false}, {"a": 3, "b": "z"}]');
+assertEquals({a: 3, b: "z"}, objects[4]);
+assertTrue(%HaveSameMap(objects[0], objects[2]));
+assertTrue(%HaveSameMap(objects[0], objects[4]));
+assertTrue(%HaveSameMap(objects[1], objects[3]));
+assertFalse(%HaveSameMap(objects[0], objects[1]));
+
+// Nested objects of alternating shapes.
+var nested = JSON.parse(
+    '[{"id": 1, "user": {"name": "a", "age": 1}},' +
+    ' {"id": 2, "user": {"name": "b", "age": 2}},' +
+    ' {"id": 3, "user": {"name": "c", "mail": "d"}}]');
+assertTrue(%HaveSameMap(nested[0], nested[2]));
+assertTrue(%HaveSameMap(nested[0].user, nested[1].user));
+assertEquals({name: "c", mail: "d"}, nested[2].user);
+
+// Keys that only share a prefix with a cached key.
+var prefixes = JSON.parse('[{"ab": 1}, {"a": 2}, {"abc": 3}, {"ab": 4}]');
+assertEquals([{ab: 1}, {a: 2}, {abc: 3}, {ab: 4}], prefixes);
+assertTrue(%HaveSameMap(prefixes[0], prefixes[3]));
+
+// Field representations are generalized as values change.
+var fields = JSON.parse('[{"x": 1, "y": 2}, {"x": 1.5, "y": "2"},' +
+                        ' {"x": {}, "y": null}]');
+assertEquals({x: {}, y: null}, fields[2]);
+assertEquals(1.5, fields[1].x);
+assertEquals("2", fields[1].y);
+
+// Strings with escapes, control characters and lengths around a word.
+for (var i = 0; i < 20; i++) {
+  var s = "a".repeat(i);
+  assertEquals(s, JSON.parse('"' + s + '"'));
+  assertEquals(s + '"', JSON.parse('"' + s + '\\""'));
+  assertEquals('\\' + s, JSON.parse('"\\\\' + s + '"'));
+  assertEquals({[s]: i}, JSON.parse('{"' + s + '": ' + i + '}'));
+  assertThrows(() => JSON.parse('"' + s + '\n"'), SyntaxError);
+  assertThrows(() => JSON.parse('"' + s + '\x1f"'), SyntaxError);
+  assertThrows(() => JSON.parse('"' + s), SyntaxError);
+  assertThrows(() => JSON.parse('{"' + s + '\t": 1}'), SyntaxError);
+}
+assertEquals("\x7f\xff ~", JSON.parse('"\x7f\xff ~"'));
+assertEquals(["01", "1", "4294967295"],
+             Object.keys(JSON.parse('{"01": 1, "1": 2, "4294967295": 3}'))
+                 .sort());
+
+// The transition cache is first filled in a nested object and then used by
+// the objects around it.
+var outer = JSON.parse(
+    '[[{"p": 1, "q": 2}, {"p": 1, "r": 3}], {"p": 4, "q": 5},' +
+    ' {"p": 6, "r": 7}]');
+assertTrue(%HaveSameMap(outer[0][0], outer[1]));
+assertTrue(%HaveSameMap(outer[0][1], outer[2]));
+assertEquals([1, "a", null], JSON.parse('[1, "a", null]'));
@@ -0,0 +1,59 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Objects of the same shape reuse their serialized keys.
+function Point(x, y) { this.x = x; this.y = y; }
+var points = [new Point(1, 2), new Point("a", null), new Point(undefined, [])];
+assertEquals('[{"x":1,"y":2},{"x":"a","y":null},{"y":[]}]',
+             JSON.stringify(points));
+assertEquals('[\n {\n  "x": 1,\n  "y": 2\n },\n {\n  "x": "a",\n  "y": null\n' +
+             ' },\n {\n  "y": []\n }\n]', JSON.stringify(points, null, 1));
+
+// Keys that need escaping, Latin1 and two-byte keys, and keys that are left
+// out.
+var keys = {"a\"b": 1, "\\": 2, "\n\x1f": 3, "\xe4": 4, "€": 5};
+Object.defineProperty(keys, "hidden", {value: 6, enumerable: false});
+keys[Symbol("s")] = 7;
+var expected = '{"a\\"b":1,"\\\\":2,"\\n\\u001f":3,"\xe4":4,"€":5}';
+assertEquals(expected, JSON.stringify(keys));
+assertEquals("[" + expected + "," + expected + "]",
+             JSON.stringify([keys, Object.assign({}, keys)]));
+assertEquals('{"€":1,"\xe4":2}', JSON.stringify({"€": 1, "\xe4": 2}));
+
+// Nested objects of many shapes.
+var shapes = [];
+for (var i = 0; i < 100; i++) {
+  var object = {};
+  object["key" + (i % 20)] = {inner: i, ["k" + i]: [i]};
+  shapes.push(object);
+}
+var copy = JSON.parse(JSON.stringify(shapes));
+assertEquals(shapes, copy);
+assertEquals('{"key5":{"inner":25,"k25":[25]}}', JSON.stringify(shapes[25]));
+
+// Getters that change the shape while serializing.
+var changing = {get a() { delete this.b; this.c = 3; return 1; }, b: 2};
+assertEquals('{"a":1}', JSON.stringify(changing));
+assertEquals('{"a":1,"c":3}', JSON.stringify(changing));
+
+// Strings with characters to escape around a word.
+for (var i = 0; i < 20; i++) {
+  var s = "a".repeat(i);
+  assertEquals('"' + s + '\\""', JSON.stringify(s + '"'));
+  assertEquals('"\\\\' + s + '"', JSON.stringify("\\" + s));
+  assertEquals('"' + s + '\\u0000' + s + '"', JSON.stringify(s + "\0" + s));
+  assertEquals('"' + s + '\x7f\xff"', JSON.stringify(s + "\x7f\xff"));
+  assertEquals('["' + s + '","ሴ"]', JSON.stringify([s, "ሴ"]));
+}
+
+// Primitive roots that turn into objects.
+assertEquals('{"a":1}', JSON.stringify(1, (k, v) => k === "" ? {a: 1} : v));
+BigInt.prototype.toJSON = () => ({a: 1});
+assertEquals('{"a":1}', JSON.stringify(1n));
+delete BigInt.prototype.toJSON;
+
+// The key cache is first filled inside a nested object and then used by
+// the objects after it.
+assertEquals('[[{"a":1}],{"a":2},{"b":3},{"a":4}]',
+             JSON.stringify([[{a: 1}], {a: 2}, {b: 3}, {a: 4}]));
@@ -0,0 +1,28 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MODULE
+// Flags: --stream-modules
+
+// Modules that are read and parsed on worker threads by d8 link and
+// evaluate like synchronously loaded ones, including shared dependencies,
+// re-exports and cycles.
+
+import * as one from "modules-skip-1.js";
+import {b, c, zzz, default as d} from "modules-skip-2.js";
+import {foo} from "modules-cycle.js";
+import {b as circular} from "modules-circular-valid.js";
+
+assertEquals(1, one.a);
+assertEquals(42, one.default);
+assertEquals(1, b);
+assertEquals(1, c);
+assertEquals(999, zzz);
+assertEquals(42, d);
+assertEquals(1, foo);
+assertEquals('value', circular.key);
+
+one.set_a(2);
+assertEquals(2, b);
+assertEquals(2, foo);
@@ -0,0 +1,19 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-linear-nested-quantifiers
+
+// Only patterns with nested quantifiers, on which backtracking can take
+// exponential time, are matched by the linear-time engine.
+
+var subject = "a".repeat(10000);
+assertNull(/(a+)+b/.exec(subject));
+assertNull(/^(a*a)*$/.exec(subject + "!"));
+assertNull(/(?:\s*\w+\s*)+;/.exec("word ".repeat(1000)));
+assertEquals(["aaab", "aaa"], /(a+)+b/.exec("xaaab"));
+assertEquals(["aa", "aa"], "xaa".match(/(a+)+/));
+
+// Everything else is unaffected.
+assertEquals(["aaab", "aaa"], /(a+)b/.exec("xaaab"));
+assertEquals(["aa", "a"], /(a)\1/.exec("xaa"));
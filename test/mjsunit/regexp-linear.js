@@ -0,0 +1,86 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-linear --harmony-regexp-named-captures
+
+// Patterns without backreferences and lookarounds are matched by the
+// linear-time engine. Its matches and captures must be those of a
+// backtracking engine.
+
+// Patterns on which backtracking takes exponential time.
+var as = "a".repeat(5000);
+assertNull(/(a+)+b/.exec(as));
+assertNull(/(a|aa)*b/.exec(as));
+assertNull(/^(\w+\s?)*$/.exec("an example sentence that ends badly!"));
+assertFalse(/(x+x+)+y/.test("x".repeat(1000)));
+assertEquals(["a".repeat(5000) + "b", "a".repeat(5000)],
+             /(a+)+b/.exec(as + "b"));
+
+// Priorities of alternatives and quantifiers.
+assertEquals(["a", "a"], /(a|ab)/.exec("ab"));
+assertEquals(["ab", "ab"], /(ab|a)/.exec("ab"));
+assertEquals(["aaa", "aa", "a"], /(a*)(a)/.exec("aaa"));
+assertEquals(["a", "", "a"], /(a*?)(a)/.exec("aaa"));
+assertEquals(["aaaa", "a", "aaa"], /(a+?)(a+)/.exec("aaaa"));
+assertEquals(["abab", "b"], /(?:a(b))+/.exec("xabab"));
+assertEquals(["aaa", "aaa"], /(a{2,4}?a)/.exec("aaaaa"));
+assertEquals(["aaaaa", "aaaaa"], /(a{2,4}a)/.exec("aaaaa"));
+
+// Captures inside quantifiers are reset on every iteration.
+assertEquals(["ab", undefined, "b"], /(?:(a)|(b))+/.exec("ab"));
+assertEquals(["ba", "a", undefined], /(?:(a)|(b))+/.exec("ba"));
+assertEquals(["zaacbbbcac", "z", "ac", "a", undefined, "c"],
+             /(z)((a+)?(b+)?(c))*/.exec("zaacbbbcac"));
+assertEquals(["abb", undefined], /(?:(a)|b){3}/.exec("abb"));
+
+// Assertions.
+assertEquals(["foo"], /^foo/.exec("foo bar"));
+assertNull(/^bar/.exec("foo bar"));
+assertEquals(["bar"], /^bar/m.exec("foo\nbar"));
+assertEquals(["foo"], /foo$/m.exec("foo\nbar"));
+assertNull(/foo$/.exec("foo\nbar"));
+assertEquals(["bar"], /\bbar\b/.exec("foobar bar"));
+assertEquals(7, "foobar bar".search(/\bbar\b/));
+assertEquals(["oo"], /\Boo\B/.exec("a foo boob"));
+
+// Character classes.
+assertEquals(["ß1_"], /[^\sa-z]\w+/.exec("ab ß1_"));
+assertEquals(["ሴስ"], /[ሰ-ስ]+/.exec("abሴስ"));
+assertEquals(["a\nb"], /a.b/s.exec("a\nb"));
+assertNull(/a.b/.exec("a\nb"));
+assertEquals(["a b"], /a[^]b/.exec("a b"));
+assertNull(/a[^]b/.exec("ab"));
+assertEquals(["123", "123"], /(\d+)/.exec("abc123def"));
+
+// Sticky and global matching.
+var re = /a+/y;
+assertNull(re.exec("baaab"));
+re.lastIndex = 1;
+assertEquals(["aaa"], re.exec("baaab"));
+assertEquals(4, re.lastIndex);
+assertEquals(["aa", "a", "aaa"], "aa b a c aaa".match(/a+/g));
+assertEquals("x b x c x", "aa b a c aaa".replace(/a+/g, "x"));
+assertEquals(["", "b", "c", ""], "a1b22c333".split(/[a\d]+/));
+assertEquals(["a", "b", "c"], "a1b22c".split(/\d+/));
+assertEquals("-a-b-", "ab".replace(/x*/g, "-"));
+assertEquals("[b][a]", "ab".replace(/(a)(b)/, "[$2][$1]"));
+
+// Named captures.
+var m = /(?<year>\d{4})-(?<month>\d{2})/.exec("on 2018-04");
+assertEquals("2018", m.groups.year);
+assertEquals("04", m.groups.month);
+assertEquals("04/2018",
+             "2018-04".replace(/(?<year>\d{4})-(?<month>\d{2})/,
+                               "$<month>/$<year>"));
+
+// Two-byte subjects.
+assertEquals(["ሴaሴ", "a"], /ሴ(a)ሴ/.exec("xሴaሴ"));
+assertNull(/(ሴ+)+x/.exec("ሴ".repeat(100)));
+
+// Patterns the engine does not support still work.
+assertEquals(["abab", "ab"], /(ab)\1/.exec("xabab"));
+assertEquals(["a"], /a(?=b)/.exec("acab"));
+assertEquals(["AB"], /ab/i.exec("xAB"));
+assertEquals(["\u{1F600}"], /./u.exec("\u{1F600}"));
+assertEquals(["", undefined], /(a?)*/.exec("b"));
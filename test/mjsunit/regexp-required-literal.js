@@ -0,0 +1,66 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-required-literal
+
+// Matching skips ahead to the occurrences of a literal that every match
+// contains. The matches found must be the same.
+
+function Check(re, subject, expected) {
+  // Both through the interpreter and native code.
+  for (var i = 0; i < 3; i++) {
+    re.lastIndex = 0;
+    assertEquals(expected, re.exec(subject));
+  }
+}
+
+var filler = "x".repeat(100);
+
+// Literals at a fixed offset from the start of the match.
+Check(/abc\d/, filler + "abc abc1", ["abc1"]);
+Check(/\d\dabc/, filler + "1abc 12abc", ["12abc"]);
+Check(/(\w)abc/, "abc zabc", ["zabc", "z"]);
+Check(/a(?:bc){2}d/, filler + "abcd abcbcd", ["abcbcd"]);
+Check(/(?:ab)+c/, "abab ababc", ["ababc"]);
+Check(/x.y/s, "x\ny", ["x\ny"]);
+
+// Literals at a bounded or unbounded offset.
+Check(/x\d{2,3}abc/, "x1abc x123abc x12abc", ["x123abc"]);
+Check(/\d+abc/, filler + "abc 1234abc", ["1234abc"]);
+Check(/\w*foo/, "foo", ["foo"]);
+Check(/(a|b)*foo/, "bbfo abfoo", ["abfoo", "b"]);
+
+// The literal is missing.
+Check(/\d+abc/, filler + "abd", null);
+Check(/a.c(d)/, filler, null);
+Check(/abc\d/, "ab", null);
+
+// Zero-width assertions around the literal.
+Check(/\bfoo\b/, "afoo foo", ["foo"]);
+Check(/^foo/m, "afoo\nfoo", ["foo"]);
+Check(/(?<=a)bc/, "bc xbc abc", ["bc"]);
+assertEquals(8, "bc xbc abc".search(/(?<=a)bc/));
+Check(/foo(?=bar)/, "foobaz foobar", ["foo"]);
+assertEquals(7, "foobaz foobar".search(/foo(?=bar)/));
+
+// Case-insensitive parts of a pattern are not literals.
+Check(/(?:x|y)ABC/i, "yabc", ["yabc"]);
+
+// Two-byte subjects and literals.
+Check(/\dabc/, "ሴ1abc", ["1abc"]);
+Check(/ሴ\d/, "ሴaሴ1", ["ሴ1"]);
+Check(/\dሴ/, filler + "1ሴ", ["1ሴ"]);
+
+// Global, sticky and last index.
+assertEquals(["1abc", "2abc"], "1abc abc 2abc".match(/\dabc/g));
+assertEquals("x-x-", "1abcdef2abc".replace(/\dabc(?:def)?/g, "x-"));
+assertEquals(["a", "b", "c"], "a12xb3xc".split(/\d+x/));
+var re = /\dabc/g;
+re.lastIndex = 2;
+assertEquals(["2abc"], re.exec("1abc2abc"));
+assertEquals(8, re.lastIndex);
+assertNull(re.exec("1abc2abc"));
+re = /\dabc/y;
+re.lastIndex = 4;
+assertEquals(["2abc"], re.exec("1abc2abc"));
@@ -0,0 +1,52 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-tier-up --regexp-tier-up-ticks=3
+
+// Regexps are run by the bytecode interpreter for their first executions and
+// compiled to native code after that. Results must not depend on the tier.
+
+function CheckExec(re, subject, expected) {
+  for (var i = 0; i < 6; i++) {
+    re.lastIndex = 0;
+    assertEquals(expected, re.exec(subject));
+  }
+}
+
+CheckExec(/(a+)(b)?/, "xaab", ["aab", "aa", "b"]);
+CheckExec(/(a+)(b)?/, "xaac", ["aa", "aa", undefined]);
+CheckExec(/(?:(a)|b)+c/, "abbc", ["abbc", undefined]);
+CheckExec(/ሴ(a)ሴ/, "xሴaሴ", ["ሴaሴ", "a"]);
+CheckExec(/^$/m, "a\n\nb", [""]);
+CheckExec(/(\d+)x/, "12y34", null);
+
+// Global loops start in the interpreter and continue in native code.
+for (var i = 0; i < 6; i++) {
+  assertEquals("[a][b][c]", "abc".replace(/(\w)/g, "[$1]"));
+  assertEquals(["1", "22", "333"], "a1b22c333".match(/\d+/g));
+  assertEquals(["a", "b", "c"], "a1b22c".split(/\d+/));
+  assertEquals("-a-b-", "ab".replace(/x*/g, "-"));
+}
+
+// Sticky matching.
+var re = /a+/y;
+for (var i = 0; i < 6; i++) {
+  re.lastIndex = 1;
+  assertEquals(["aa"], re.exec("baab"));
+  assertEquals(3, re.lastIndex);
+  assertNull(re.exec("baab"));
+}
+
+// Long subjects are matched with native code right away.
+var long_subject = "a".repeat(5000) + "b";
+assertEquals(["a".repeat(5000) + "b"], /a+b/.exec(long_subject));
+assertEquals(5000, long_subject.search(/b/));
+
+// Patterns that backtrack a lot on short subjects, which may exhaust the
+// backtrack stack of the interpreter.
+var subject = "ab".repeat(495) + "c";
+for (var i = 0; i < 6; i++) {
+  assertEquals([subject, undefined, "b"], /(?:(a)|(b))*c/.exec(subject));
+  assertNull(/(?:(a)|(b))*d/.exec(subject));
+}
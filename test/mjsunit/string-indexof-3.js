@@ -0,0 +1,56 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Short patterns and single characters in two-byte subjects are searched a
+// word at a time. Check every offset of the match relative to the word
+// boundaries, with characters that share a byte with the pattern around it.
+
+function NaiveIndexOf(subject, pattern, start) {
+  outer: for (var i = start; i + pattern.length <= subject.length; i++) {
+    for (var j = 0; j < pattern.length; j++) {
+      if (subject[j + i] !== pattern[j]) continue outer;
+    }
+    return i;
+  }
+  return -1;
+}
+
+var fillers = ["一丁", "ⵎ中", "ab", "中Ā"];
+var patterns = ["中", "中文", "中a", "a中", "中中",
+                "中一中", "ab中", "中一丁中"];
+
+for (var f = 0; f < fillers.length; f++) {
+  for (var p = 0; p < patterns.length; p++) {
+    var pattern = patterns[p];
+    for (var prefix = 0; prefix < 20; prefix++) {
+      var subject = fillers[f].repeat(prefix) + "一" + pattern +
+                    fillers[f].repeat(3);
+      var expected = NaiveIndexOf(subject, pattern, 0);
+      assertEquals(expected, subject.indexOf(pattern), subject);
+      assertEquals(expected >= 0, subject.includes(pattern), subject);
+      for (var start = 0; start < subject.length; start += 3) {
+        assertEquals(NaiveIndexOf(subject, pattern, start),
+                     subject.indexOf(pattern, start), subject);
+      }
+      assertEquals(subject.length - subject.split(pattern).join("").length,
+                   pattern.length * (subject.split(pattern).length - 1));
+      if (expected >= 0) {
+        assertEquals(subject.substring(0, expected) + "X" +
+                     subject.substring(expected + pattern.length),
+                     subject.replace(pattern, "X"));
+      }
+    }
+  }
+}
+
+// A pattern whose first and last characters match but whose middle does not.
+var subject = "中x中".repeat(10) + "中y中";
+assertEquals(30, subject.indexOf("中y中"));
+assertEquals(-1, subject.indexOf("中z中"));
+
+// One-byte patterns in two-byte subjects and vice versa.
+assertEquals(5, "一一一一一ab".indexOf("ab"));
+assertEquals(-1, "abcdefgh".indexOf("c中"));
+assertEquals(["a", "b", "c"], "a中b中c".split("中"));
+assertEquals(["一", "丁", ""], "一,丁,".split(","));
@@ -276,6 +276,28 @@ TEST(Bits, SignedMulHighAndAdd32) {
 }
 
 
+TEST(Bits, UnsignedMulFull64) {
+  uint64_t high;
+  EXPECT_EQ(0u, UnsignedMulFull64(0, 0, &high));
+  EXPECT_EQ(0u, high);
+  TRACED_FORRANGE(uint64_t, i, 1, 50) {
+    TRACED_FORRANGE(uint64_t, j, 1, i) {
+      EXPECT_EQ(i * j, UnsignedMulFull64(i, j, &high));
+      EXPECT_EQ(0u, high);
+    }
+  }
+  const uint64_t kMax = std::numeric_limits<uint64_t>::max();
+  EXPECT_EQ(1u, UnsignedMulFull64(kMax, kMax, &high));
+  EXPECT_EQ(kMax - 1, high);
+  EXPECT_EQ(0u, UnsignedMulFull64(uint64_t{1} << 63, 4, &high));
+  EXPECT_EQ(2u, high);
+  EXPECT_EQ(uint64_t{0x0000000100000000},
+            UnsignedMulFull64(uint64_t{0xFFFFFFFF00000001},
+                              uint64_t{0x0000000100000000}, &high));
+  EXPECT_EQ(uint64_t{0x00000000FFFFFFFF}, high);
+}
+
+
 TEST(Bits, SignedDiv32) {
   EXPECT_EQ(std::numeric_limits<int32_t>::min(),
             SignedDiv32(std::numeric_limits<int32_t>::min(), -1));
@@ -501,5 +501,58 @@ TEST(UnicodeTest, IncrementalUTF8DecodingVsNonIncrementalUtf8Decoding) {
   }
 }
 
+TEST(UnicodeTest, NonAsciiStart) {
+  std::vector<byte> bytes(64, 'a');
+  for (size_t offset = 0; offset < 8; offset++) {
+    for (size_t length = 0; length <= bytes.size() - offset; length++) {
+      CHECK_EQ(length, unibrow::Utf8::NonAsciiStart(&bytes[offset], length));
+      for (size_t i = offset; i < offset + length; i++) {
+        bytes[i] = 0x80;
+        CHECK_EQ(i - offset,
+                 unibrow::Utf8::NonAsciiStart(&bytes[offset], length));
+        bytes[i] = 'a';
+      }
+    }
+  }
+}
+
+TEST(UnicodeTest, AsciiRunsAndNonAsciiCharacters) {
+  // Long runs of ASCII characters take the bulk paths of the decoders, which
+  // have to agree with decoding one byte at a time around every kind of
+  // character, at every alignment and across buffer boundaries.
+  std::vector<std::vector<byte>> characters = {
+      {0xC2, 0x80},              // 2 bytes
+      {0xE0, 0xA0, 0x80},        // 3 bytes
+      {0xF0, 0x90, 0x80, 0x80},  // 4 bytes, a surrogate pair in UTF-16
+      {0xE8, 0x80},              // incomplete
+      {0xBF},                    // unexpected continuation byte
+      {0xED, 0xA0, 0x80},        // single surrogate
+  };
+  unibrow::Utf8Decoder<50> utf16_decoder;
+
+  for (const std::vector<byte>& character : characters) {
+    for (size_t prefix_length = 0; prefix_length < 70; prefix_length += 3) {
+      std::vector<byte> bytes(prefix_length, 'a');
+      bytes.insert(bytes.end(), character.begin(), character.end());
+      bytes.insert(bytes.end(), 40, 'b');
+      bytes.insert(bytes.end(), character.begin(), character.end());
+
+      std::vector<unibrow::uchar> output_incremental;
+      DecodeIncrementally(bytes, &output_incremental);
+
+      std::vector<unibrow::uchar> output_utf16;
+      DecodeUtf16(&utf16_decoder, bytes, &output_utf16);
+      CHECK(output_utf16 == output_incremental);
+
+      CHECK_EQ(prefix_length,
+               unibrow::Utf8::NonAsciiStart(bytes.data(), bytes.size()));
+      bool valid = character.size() > 1 && character[0] != 0xE8 &&
+                   character[0] != 0xED;
+      CHECK_EQ(valid,
+               unibrow::Utf8::ValidateEncoding(bytes.data(), bytes.size()));
+    }
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -109,5 +109,50 @@ TYPED_TEST(UtilsTest, SaturateAdd) {
   }
 }
 
+TEST(UtilsTest, CompareCharsTwoByte) {
+  // Differences in every position relative to the word boundaries, in both
+  // the low and the high byte of a character.
+  const uint16_t kChars[] = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h',
+                             'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p'};
+  const size_t kLength = arraysize(kChars);
+  for (size_t i = 0; i < kLength; i++) {
+    uint16_t other[kLength];
+    memcpy(other, kChars, sizeof(kChars));
+    EXPECT_EQ(0, CompareChars(kChars, other, kLength));
+    EXPECT_TRUE(CompareCharsEqual(kChars, other, kLength));
+    other[i] = 0x100 + kChars[i];
+    EXPECT_GT(0, CompareChars(kChars, other, kLength));
+    EXPECT_LT(0, CompareChars(other, kChars, kLength));
+    EXPECT_EQ(0, CompareChars(kChars, other, i));
+    EXPECT_FALSE(CompareCharsEqual(kChars, other, kLength));
+    EXPECT_TRUE(CompareCharsEqual(kChars, other, i));
+    other[i] = kChars[i] - 1;
+    EXPECT_LT(0, CompareChars(kChars, other, kLength));
+    EXPECT_FALSE(CompareCharsEqual(kChars, other, kLength));
+  }
+}
+
+TEST(UtilsTest, CompareCharsEqualMixedWidths) {
+  const uint8_t kOneByte[] = "abcdefghijklmnopq";
+  const size_t kLength = arraysize(kOneByte) - 1;
+  uint16_t two_byte[kLength];
+  for (size_t i = 0; i < kLength; i++) two_byte[i] = kOneByte[i];
+  for (size_t length = 0; length <= kLength; length++) {
+    EXPECT_TRUE(CompareCharsEqual(kOneByte, two_byte, length));
+    EXPECT_TRUE(CompareCharsEqual(two_byte, kOneByte, length));
+  }
+  for (size_t i = 0; i < kLength; i++) {
+    // A character that only differs in its high byte.
+    two_byte[i] = 0x100 | kOneByte[i];
+    EXPECT_FALSE(CompareCharsEqual(kOneByte, two_byte, kLength));
+    EXPECT_FALSE(CompareCharsEqual(two_byte, kOneByte, kLength));
+    EXPECT_TRUE(CompareCharsEqual(kOneByte, two_byte, i));
+    // Unaligned one-byte input.
+    EXPECT_EQ(i == 0,
+              CompareCharsEqual(kOneByte + 1, two_byte + 1, kLength - 1));
+    two_byte[i] = kOneByte[i];
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
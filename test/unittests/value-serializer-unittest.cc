@@ -1158,6 +1158,103 @@ TEST_F(ValueSerializerTest, DecodeDenseArrayContainingUndefined) {
   ExpectScriptTrue("!(0 in result)");
 }
 
+class ValueSerializerTestWithCompactEncoding : public ValueSerializerTest {
+ protected:
+  void BeforeEncode(ValueSerializer* serializer) override {
+    serializer->SetUseCompactEncoding(true);
+  }
+};
+
+TEST_F(ValueSerializerTestWithCompactEncoding, RoundTripObjectsWithShapes) {
+  // Objects with the same map share a shape, even when their field
+  // representations differ.
+  RoundTripJSON(
+      "[{\"x\":1,\"y\":\"a\"},{\"x\":2.5,\"y\":\"b\"}"
+      ",{\"x\":3,\"y\":{\"x\":4,\"y\":null}},{\"y\":1,\"x\":2}"
+      ",{\"x\":5,\"y\":\"c\"},{}]");
+
+  // References to objects read with a shape, including cyclic ones.
+  Local<Value> value =
+      RoundTripTest("var o = {a: 1}; o.self = o; [o, {a: 2, self: o}, o]");
+  ASSERT_TRUE(value->IsArray());
+  ExpectScriptTrue("result[0].self === result[0]");
+  ExpectScriptTrue("result[1].self === result[0]");
+  ExpectScriptTrue("result[2] === result[0]");
+  ExpectScriptTrue("result[1].a === 2");
+
+  // A property deleted while serializing is left out.
+  value = RoundTripTest(
+      "[{a: 1, b: 2}, {get a() { delete this.b; return 3; }, b: 4},"
+      " {a: 5, b: 6}]");
+  ExpectScriptTrue("result[0].a === 1 && result[0].b === 2");
+  ExpectScriptTrue(
+      "Object.getOwnPropertyNames(result[1]).toString() === 'a'");
+  ExpectScriptTrue("result[1].a === 3");
+  ExpectScriptTrue("result[2].a === 5 && result[2].b === 6");
+}
+
+TEST_F(ValueSerializerTestWithCompactEncoding, RoundTripPackedDoubleArray) {
+  Local<Value> value = RoundTripTest("[1.5, -0, NaN, Infinity, 2.25]");
+  ASSERT_TRUE(value->IsArray());
+  EXPECT_EQ(5u, Array::Cast(*value)->Length());
+  ExpectScriptTrue("result[0] === 1.5");
+  ExpectScriptTrue("Object.is(result[1], -0)");
+  ExpectScriptTrue("Number.isNaN(result[2])");
+  ExpectScriptTrue("result[3] === Infinity");
+  ExpectScriptTrue("result[4] === 2.25");
+
+  // Properties are written after the elements.
+  value = RoundTripTest("var a = [0.5, 1.5]; a.foo = 'bar'; a");
+  ExpectScriptTrue("result.length === 2 && result[1] === 1.5");
+  ExpectScriptTrue("result.foo === 'bar'");
+
+  RoundTripJSON("[{\"p\":[0.5,1.5]},{\"p\":[2.5]},{\"p\":[]}]");
+}
+
+TEST_F(ValueSerializerTest, DecodeShapedObjects) {
+  // A shape with the single property "a", and a second object using it.
+  Local<Value> value =
+      DecodeTest({0xFF, 0x0E, 0x41, 0x02, 0x6A, 0x00, 0x01, 0x22, 0x01, 0x61,
+                  0x49, 0x02, 0x6A, 0x00, 0x49, 0x04, 0x24, 0x00, 0x02});
+  ASSERT_TRUE(value->IsArray());
+  ExpectScriptTrue("result.length === 2");
+  ExpectScriptTrue("Object.getPrototypeOf(result[0]) === Object.prototype");
+  ExpectScriptTrue("result[0].a === 1 && result[1].a === 2");
+
+  // The hole marks a property that is absent.
+  value = DecodeTest({0xFF, 0x0E, 0x6A, 0x00, 0x01, 0x22, 0x01, 0x61, 0x2D});
+  ASSERT_TRUE(value->IsObject());
+  ExpectScriptTrue("Object.getOwnPropertyNames(result).length === 0");
+
+  // Shapes must be defined before they are used.
+  InvalidDecodeTest({0xFF, 0x0E, 0x6A, 0x01, 0x01, 0x22, 0x01, 0x61, 0x49,
+                     0x02});
+  // Too few values.
+  InvalidDecodeTest({0xFF, 0x0E, 0x6A, 0x00, 0x02, 0x22, 0x01, 0x61, 0x22,
+                     0x01, 0x62, 0x49, 0x02});
+  // Shapes were added in version 14.
+  InvalidDecodeTest({0xFF, 0x0D, 0x6A, 0x00, 0x01, 0x22, 0x01, 0x61, 0x2D});
+}
+
+TEST_F(ValueSerializerTest, DecodePackedDoubleArray) {
+  // The bit pattern of the hole must be read as an ordinary NaN.
+  Local<Value> value =
+      DecodeTest({0xFF, 0x0E, 0x70, 0x01, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
+                  0xF7, 0xFF, 0x24, 0x00, 0x01});
+  ASSERT_TRUE(value->IsArray());
+  ExpectScriptTrue("result.length === 1 && result.hasOwnProperty(0)");
+  ExpectScriptTrue("Number.isNaN(result[0])");
+
+  // Fewer bytes than the length requires.
+  InvalidDecodeTest({0xFF, 0x0E, 0x70, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+                     0x00, 0xF0, 0x3F, 0x24, 0x00, 0x02});
+  // An empty array is always written as a dense array.
+  InvalidDecodeTest({0xFF, 0x0E, 0x70, 0x00, 0x24, 0x00, 0x00});
+  // Packed double arrays were added in version 14.
+  InvalidDecodeTest({0xFF, 0x0D, 0x70, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+                     0x00, 0xF0, 0x3F, 0x24, 0x00, 0x01});
+}
+
 TEST_F(ValueSerializerTest, RoundTripDate) {
   Local<Value> value = RoundTripTest("new Date(1e6)");
   ASSERT_TRUE(value->IsDate());
@@ -21,12 +21,41 @@ TEST(Zone, SegmentPoolConstraints) {
     size_t total_size = 0;
     for (size_t power = 0; power < AccountingAllocator::kNumberBuckets;
          ++power) {
-      total_size +=
-          allocator.unused_segments_max_sizes_[power] * (size_t(1) << power);
+      size_t segment_size =
+          size_t(1) << (power + AccountingAllocator::kMinSegmentSizePower);
+      total_size += allocator.unused_segments_max_sizes_[power] * segment_size;
     }
     EXPECT_LE(total_size, size);
   }
 }
 
+TEST(Zone, SegmentPoolHoldsMaximumSegments) {
+  AccountingAllocator allocator;
+  allocator.ConfigureSegmentPool(
+      AccountingAllocator::kPoolSizeForMaximumSegments);
+  for (size_t power = 0; power < AccountingAllocator::kNumberBuckets;
+       ++power) {
+    EXPECT_LE(1u, allocator.unused_segments_max_sizes_[power]);
+  }
+
+  // A returned segment of the maximum zone segment size is reused.
+  Segment* segment = allocator.GetSegment(1 * MB);
+  ASSERT_NE(nullptr, segment);
+  allocator.ReturnSegment(segment);
+  EXPECT_EQ(static_cast<size_t>(1 * MB), allocator.GetCurrentPoolSize());
+  EXPECT_EQ(segment, allocator.GetSegment(1 * MB));
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+  allocator.ReturnSegment(segment);
+}
+
+TEST(Zone, SegmentPoolOfSizeZeroIsDisabled) {
+  AccountingAllocator allocator;
+  allocator.ConfigureSegmentPool(0);
+  Segment* segment = allocator.GetSegment(8 * KB);
+  ASSERT_NE(nullptr, segment);
+  allocator.ReturnSegment(segment);
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -36,6 +36,7 @@
 #include "include/libplatform/libplatform.h"
 #include "src/api.h"
 #include "src/compiler.h"
+#include "src/interpreter/interpreter.h"
 #include "src/objects-inl.h"
 #include "src/parsing/parse-info.h"
 #include "src/parsing/parsing.h"
@@ -58,11 +59,10 @@ class StringResource8 : public v8::String::ExternalOneByteStringResource {
   int length_;
 };
 
-v8::base::TimeDelta RunBaselineParser(const char* fname, Encoding encoding,
-                                      int repeat, v8::Isolate* isolate,
-                                      v8::Local<v8::Context> context) {
-  int length = 0;
-  const byte* source = ReadFileAndRepeat(fname, &length, repeat);
+v8::Local<v8::String> ReadSource(const char* fname, Encoding encoding,
+                                 int repeat, v8::Isolate* isolate,
+                                 int* length) {
+  const byte* source = ReadFileAndRepeat(fname, length, repeat);
   v8::Local<v8::String> source_handle;
   switch (encoding) {
     case UTF8: {
@@ -75,17 +75,26 @@ v8::base::TimeDelta RunBaselineParser(const char* fname, Encoding encoding,
       source_handle =
           v8::String::NewFromTwoByte(
               isolate, reinterpret_cast<const uint16_t*>(source),
-              v8::NewStringType::kNormal, length / 2).ToLocalChecked();
+              v8::NewStringType::kNormal, *length / 2).ToLocalChecked();
       break;
     }
     case LATIN1: {
       StringResource8* string_resource =
-          new StringResource8(reinterpret_cast<const char*>(source), length);
+          new StringResource8(reinterpret_cast<const char*>(source), *length);
       source_handle = v8::String::NewExternalOneByte(isolate, string_resource)
                           .ToLocalChecked();
       break;
     }
   }
+  return source_handle;
+}
+
+v8::base::TimeDelta RunBaselineParser(const char* fname, Encoding encoding,
+                                      int repeat, v8::Isolate* isolate,
+                                      v8::Local<v8::Context> context) {
+  int length = 0;
+  v8::Local<v8::String> source_handle =
+      ReadSource(fname, encoding, repeat, isolate, &length);
   v8::base::TimeDelta parse_time1;
   Handle<Script> script =
       reinterpret_cast<i::Isolate*>(isolate)->factory()->NewScript(
@@ -103,6 +112,101 @@ v8::base::TimeDelta RunBaselineParser(const char* fname, Encoding encoding,
   return parse_time1;
 }
 
+// The phases measured by --phases. Each phase only includes its own work:
+// the scope analysis and bytecode generation phases run on the result of
+// the full parse.
+enum Phase {
+  kScan,
+  kPreParse,
+  kFullParse,
+  kScopeAnalysis,
+  kBytecodeGeneration,
+  kNumberOfPhases
+};
+
+const char* const kPhaseNames[] = {"Scan", "PreParse", "FullParse",
+                                   "ScopeAnalysis", "BytecodeGeneration"};
+
+// Sums up the time of all runtime call counters, and resets them for the next
+// phase.
+v8::base::TimeDelta TakeRuntimeCallStatsTime(Isolate* isolate,
+                                             bool print_stats) {
+  RuntimeCallStats* stats = isolate->counters()->runtime_call_stats();
+  v8::base::TimeDelta total;
+  for (int i = 0; i < RuntimeCallStats::kNumberOfCounters; i++) {
+    total += stats->GetCounter(i)->time();
+  }
+  if (print_stats) stats->Print();
+  stats->Reset();
+  return total;
+}
+
+// Tokenizes the whole source without a parser. Regular expressions and
+// template literals are not recognized, which is fine for measuring the
+// scanner's throughput on typical code.
+v8::base::TimeDelta RunScanner(Handle<String> source) {
+  UnicodeCache unicode_cache;
+  Scanner scanner(&unicode_cache);
+  std::unique_ptr<Utf16CharacterStream> stream(ScannerStream::For(source));
+  v8::base::ElapsedTimer timer;
+  timer.Start();
+  scanner.Initialize(stream.get(), false);
+  while (scanner.Next() != Token::EOS) {
+  }
+  return timer.Elapsed();
+}
+
+bool GenerateBytecode(ParseInfo* info, FunctionLiteral* literal,
+                      AccountingAllocator* allocator) {
+  ZoneVector<FunctionLiteral*> eager_inner_literals(0, info->zone());
+  std::unique_ptr<UnoptimizedCompilationJob> job(
+      interpreter::Interpreter::NewCompilationJob(info, literal, allocator,
+                                                  &eager_inner_literals));
+  if (job->ExecuteJob() != CompilationJob::SUCCEEDED) return false;
+  for (FunctionLiteral* inner_literal : eager_inner_literals) {
+    if (!GenerateBytecode(info, inner_literal, allocator)) return false;
+  }
+  return true;
+}
+
+// Runs all phases over the source and adds the time spent in each of them to
+// |phase_times|. Parser phases are measured with the runtime call stats, so
+// that setup costs outside of the parser and compiler aren't included.
+bool RunPhases(const char* fname, Encoding encoding, int repeat,
+               v8::Isolate* isolate, bool print_stats, int* length,
+               v8::base::TimeDelta* phase_times) {
+  Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+  v8::HandleScope handle_scope(isolate);
+  Handle<String> source = v8::Utils::OpenHandle(
+      *ReadSource(fname, encoding, repeat, isolate, length));
+  source = String::Flatten(source);
+
+  phase_times[kScan] += RunScanner(source);
+
+  TakeRuntimeCallStatsTime(i_isolate, false);
+  {
+    ParseInfo info(i_isolate->factory()->NewScript(source));
+    if (!parsing::ParseProgram(&info, i_isolate)) return false;
+    phase_times[kPreParse] += TakeRuntimeCallStatsTime(i_isolate, print_stats);
+  }
+
+  ParseInfo info(i_isolate->factory()->NewScript(source));
+  info.set_allow_lazy_parsing(false);
+  info.set_eager(true);
+  if (!parsing::ParseProgram(&info, i_isolate)) return false;
+  phase_times[kFullParse] += TakeRuntimeCallStatsTime(i_isolate, print_stats);
+
+  if (!Compiler::Analyze(&info)) return false;
+  phase_times[kScopeAnalysis] +=
+      TakeRuntimeCallStatsTime(i_isolate, print_stats);
+
+  if (!GenerateBytecode(&info, info.literal(), i_isolate->allocator())) {
+    return false;
+  }
+  phase_times[kBytecodeGeneration] +=
+      TakeRuntimeCallStatsTime(i_isolate, print_stats);
+  return true;
+}
 
 int main(int argc, char* argv[]) {
   v8::V8::SetFlagsFromCommandLine(&argc, argv, true);
@@ -116,6 +220,9 @@ int main(int argc, char* argv[]) {
   std::vector<std::string> fnames;
   std::string benchmark;
   int repeat = 1;
+  int iterations = 1;
+  bool phases = false;
+  bool print_stats = false;
   for (int i = 0; i < argc; ++i) {
     if (strcmp(argv[i], "--latin1") == 0) {
       encoding = LATIN1;
@@ -128,6 +235,13 @@ int main(int argc, char* argv[]) {
     } else if (strncmp(argv[i], "--repeat=", 9) == 0) {
       std::string repeat_str = std::string(argv[i]).substr(9);
       repeat = atoi(repeat_str.c_str());
+    } else if (strncmp(argv[i], "--iterations=", 13) == 0) {
+      std::string iterations_str = std::string(argv[i]).substr(13);
+      iterations = atoi(iterations_str.c_str());
+    } else if (strcmp(argv[i], "--phases") == 0) {
+      phases = true;
+    } else if (strcmp(argv[i], "--print-phase-stats") == 0) {
+      print_stats = true;
     } else if (i > 0 && argv[i][0] != '-') {
       fnames.push_back(std::string(argv[i]));
     }
@@ -142,7 +256,32 @@ int main(int argc, char* argv[]) {
     v8::Local<v8::ObjectTemplate> global = v8::ObjectTemplate::New(isolate);
     v8::Local<v8::Context> context = v8::Context::New(isolate, NULL, global);
     DCHECK(!context.IsEmpty());
-    {
+    if (phases) {
+      v8::Context::Scope scope(context);
+      // The parser phases are measured with the runtime call stats.
+      FLAG_runtime_stats = 1;
+      v8::base::TimeDelta phase_times[kNumberOfPhases];
+      double total_bytes = 0;
+      for (int iteration = 0; iteration < iterations; iteration++) {
+        for (size_t i = 0; i < fnames.size(); i++) {
+          int length = 0;
+          if (!RunPhases(fnames[i].c_str(), encoding, repeat, isolate,
+                         print_stats, &length, phase_times)) {
+            fprintf(stderr, "Parsing %s failed\n", fnames[i].c_str());
+            return 1;
+          }
+          total_bytes += length;
+        }
+      }
+      if (benchmark.empty()) benchmark = "Phases";
+      for (int phase = 0; phase < kNumberOfPhases; phase++) {
+        double ms = phase_times[phase].InMillisecondsF();
+        printf("%s-%s(RunTime): %.3f ms\n", benchmark.c_str(),
+               kPhaseNames[phase], ms);
+        printf("%s-%s(Throughput): %.2f MB/s\n", benchmark.c_str(),
+               kPhaseNames[phase], ms > 0 ? total_bytes / MB / (ms / 1000) : 0);
+      }
+    } else {
       v8::Context::Scope scope(context);
       double first_parse_total = 0;
       for (size_t i = 0; i < fnames.size(); i++) {